@@ -651,10 +651,35 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     vector< MapSource* > allsources;
 
     int i;
-    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    int nsurf = ( int )m_SurfVec.size();
+
+    //==== Reuse Curvature From The Last Mesh For Unchanged Surfaces ====//
+    vector< vector< double > > curv_keys( nsurf );
+    vector< CurvTargetMap > curv_maps( nsurf );
+    for ( i = 0 ; i < nsurf ; i++ )
+    {
+        m_SurfVec[i]->GetCurvMapKey( curv_keys[i] );
+
+        map< vector< double >, CurvTargetMap >::iterator it = m_CurvMapCache.find( curv_keys[i] );
+        if ( it != m_CurvMapCache.end() )
+        {
+            curv_maps[i] = it->second;
+        }
+    }
+
+    ParallelUtil::ParallelFor( nsurf, [&]( int s )
+    {
+        m_SurfVec[s]->BuildTargetMap( s, curv_maps[s] );
+        m_SurfVec[s]->LimitTargetMap();
+    }, GetNumMeshThreads() );
+
+    // Only keep the surfaces of this mesh
+    m_CurvMapCache.clear();
+    for ( i = 0 ; i < nsurf ; i++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
-        m_SurfVec[i]->LimitTargetMap();
+        m_CurvMapCache[ curv_keys[i] ].m_Pnts.swap( curv_maps[i].m_Pnts );
+        m_CurvMapCache[ curv_keys[i] ].m_Len.swap( curv_maps[i].m_Len );
+        m_SurfVec[i]->LoadMapSources( allsources );
     }
 
     // Set up split sources to provide a source at the endpoint of curves where
@@ -744,13 +769,34 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
 
 void CfdMeshMgrSingleton::Remesh( int output_type )
 {
-    char str[256];
-    int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; ++i )
+    vector< int > surf_num_tris( nsurf, 0 );
+    vector< vector< double > > remesh_keys( nsurf );
+    vector< MeshData > remesh_data( nsurf );
+
+    //==== Each Surface Mesh Is Independent ====//
+    ParallelUtil::ParallelFor( nsurf, [&]( int i )
     {
+        char str[256];
         int num_tris = 0;
 
+        //==== Surfaces Unchanged Since The Last Mesh Reuse Its Result ====//
+        m_SurfVec[i]->GetMesh()->GetRemeshKey( remesh_keys[i] );
+        map< vector< double >, MeshData >::const_iterator it = m_RemeshCache.find( remesh_keys[i] );
+        if ( it != m_RemeshCache.end() )
+        {
+            m_SurfVec[i]->GetMesh()->LoadData( it->second );
+            remesh_data[i] = it->second;
+            surf_num_tris[i] = m_SurfVec[i]->GetMesh()->GetNumFaces();
+
+            sprintf( str, _("Surf %d/%d Unchanged Num Tris = %d\n"), i + 1, nsurf, surf_num_tris[i] );
+            if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+            {
+                addOutputText( str, output_type );
+            }
+            return;
+        }
+
         int num_rev_removed = 0;
 
         for ( int iter = 0 ; iter < 10 ; ++iter )
@@ -769,7 +815,7 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
                 addOutputText( str, output_type );
             }
         }
-        total_num_tris += num_tris;
+        surf_num_tris[i] = num_tris;
 
         if ( num_rev_removed > 0 )
         {
@@ -779,10 +825,26 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
                 addOutputText( str, output_type );
             }
         }
+
+        m_SurfVec[i]->GetMesh()->SaveData( remesh_data[i] );
+    }, GetNumMeshThreads() );
+
+    //==== Keep Only The Current Surfaces ====//
+    m_RemeshCache.clear();
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        std::swap( m_RemeshCache[ remesh_keys[i] ], remesh_data[i] );
+    }
+
+    int total_num_tris = 0;
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        total_num_tris += surf_num_tris[i];
     }
 
     WakeMgr.StretchWakes();
 
+    char str[256];
     sprintf( str, _("Total Num Tris = %d\n"), total_num_tris );
     addOutputText( str, output_type );
 }
@@ -849,21 +911,12 @@ string CfdMeshMgrSingleton::GetQualString()
 
 void CfdMeshMgrSingleton::ExportFiles()
 {
-    if ( GetSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME ) )
-    {
-        if ( !m_Vehicle->m_STLMultiSolid() )
-        {
-            WriteSTL( GetSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
-        }
-        else
-        {
-            WriteTaggedSTL( GetSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME ) );
-        }
-    }
-    if ( GetSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME ) )
-    {
-        WriteTetGen( GetSettingsPtr()->GetExportFileName( vsp::CFD_POLY_FILE_NAME ) );
-    }
+    int nsurf = ( int )m_SurfVec.size();
+
+    bool stl_flag = GetSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME );
+    bool tagged_stl_flag = stl_flag && m_Vehicle->m_STLMultiSolid();
+    bool poly_flag = GetSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME );
+    bool facet_flag = GetSettingsPtr()->GetExportFileFlag( vsp::CFD_FACET_FILE_NAME );
 
     string dat_fn;
     if (  GetSettingsPtr()->GetExportFileFlag( vsp::CFD_DAT_FILE_NAME ) )
@@ -896,75 +949,159 @@ void CfdMeshMgrSingleton::ExportFiles()
         vspaero_fn = GetSettingsPtr()->GetExportFileName( vsp::CFD_VSPGEOM_FILE_NAME );
     }
 
-    WriteNASCART_Obj_Tri_Gmsh( dat_fn, key_fn, obj_fn, tri_fn, gmsh_fn, vspaero_fn );
+    //==== Merge Points Once For Every Format That Uses The Same Surfaces ====//
+    vector< bool > all_surf( nsurf, true );
+    vector< bool > body_surf( nsurf );
+    vector< bool > wake_surf( nsurf );
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        wake_surf[i] = m_SurfVec[i]->GetWakeFlag();
+        body_surf[i] = !wake_surf[i];
+    }
 
-    if ( GetSettingsPtr()->GetExportFileFlag( vsp::CFD_FACET_FILE_NAME ) )
+    ExportPntIndex all_ind;
+    if ( tagged_stl_flag || poly_flag )
     {
-        WriteFacet( GetSettingsPtr()->GetExportFileName( vsp::CFD_FACET_FILE_NAME ) );
+        BuildExportPntIndex( all_surf, all_ind );
+    }
+
+    // Built even with no files to write, WriteNASCART_Obj_Tri_Gmsh always ran
+    ExportPntIndex body_ind;
+    ExportPntIndex wake_ind;
+    BuildExportPntIndex( body_surf, body_ind );
+    BuildExportPntIndex( wake_surf, wake_ind );
+
+    //==== Each Writer Only Reads The Meshes, Run Them Together ====//
+    vector< std::function< void () > > writers;
+
+    if ( stl_flag )
+    {
+        string stl_fn = GetSettingsPtr()->GetExportFileName( vsp::CFD_STL_FILE_NAME );
+        if ( !tagged_stl_flag )
+        {
+            writers.push_back( [=]() { WriteSTL( stl_fn ); } );
+        }
+        else
+        {
+            writers.push_back( [=, &all_ind]() { WriteTaggedSTL( stl_fn, all_ind ); } );
+        }
+    }
+    if ( poly_flag )
+    {
+        string poly_fn = GetSettingsPtr()->GetExportFileName( vsp::CFD_POLY_FILE_NAME );
+        writers.push_back( [=, &all_ind]() { WriteTetGen( poly_fn, all_ind ); } );
+    }
+
+    writers.push_back( [=, &body_ind, &wake_ind]()
+    {
+        WriteNASCART_Obj_Tri_Gmsh( dat_fn, key_fn, obj_fn, tri_fn, gmsh_fn, vspaero_fn, body_ind, wake_ind );
+    } );
+
+    if ( facet_flag )
+    {
+        string facet_fn = GetSettingsPtr()->GetExportFileName( vsp::CFD_FACET_FILE_NAME );
+        writers.push_back( [=, &body_ind]() { WriteFacet( facet_fn, body_ind ); } );
     }
 
     if ( GetSettingsPtr()->GetExportFileFlag( vsp::CFD_TKEY_FILE_NAME ) )
     {
-        SubSurfaceMgr.WriteTKeyFile(GetSettingsPtr()->GetExportFileName(vsp::CFD_TKEY_FILE_NAME));
+        string tkey_fn = GetSettingsPtr()->GetExportFileName( vsp::CFD_TKEY_FILE_NAME );
+        writers.push_back( [=]() { SubSurfaceMgr.WriteTKeyFile( tkey_fn ); } );
     }
+
+    ParallelUtil::ParallelFor( ( int )writers.size(), [&]( int i )
+    {
+        writers[i]();
+    }, GetNumMeshThreads() );
 }
 
-void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
+//==== Merge Coincident Points Of The Included Surfaces And Look Up Every SimpPnt Once ====//
+void CfdMeshMgrSingleton::BuildExportPntIndex( const vector< bool > & include_surf, ExportPntIndex & pnt_ind )
 {
-    //==== Find All Points and Tri Counts ====//
+    int nsurf = ( int )m_SurfVec.size();
+
     vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    for ( int i = 0 ; i < nsurf ; i++ )
     {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
+        if ( include_surf[i] )
         {
-            allPntVec.push_back( &sPntVec[v] );
+            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
+            {
+                allPntVec.push_back( &sPntVec[v] );
+            }
         }
     }
 
+    pnt_ind = ExportPntIndex();
+    pnt_ind.m_SurfPntInd.resize( nsurf );
+
+    if ( allPntVec.empty() )
+    {
+        return;
+    }
+
     //==== Build Map ====//
     map< int, vector< int > > indMap;
     vector< int > pntShift;
     BuildIndMap( allPntVec, indMap, pntShift );
 
-    //==== Assemble Normal Tris ====//
-    vector< SimpFace > allFaceVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    //==== Assemble All Used Points ====//
+    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
     {
-        vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int f = 0 ; f <  ( int )sFaceVec.size() ; f++ )
+        if ( pntShift[i] >= 0 )
         {
-            int i0 = FindPntIndex( sPntVec[sFaceVec[f].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sFaceVec[f].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sFaceVec[f].ind2], allPntVec, indMap );
-            SimpFace sface;
-            sface.ind0 = pntShift[i0];
-            sface.ind1 = pntShift[i1];
-            sface.ind2 = pntShift[i2];
+            pnt_ind.m_UsedPntVec.push_back( allPntVec[i] );
+            pnt_ind.m_UsedPntID.push_back( i );
+        }
+    }
 
-            if( sFaceVec[f].m_isQuad )
+    //==== Lookups Only Read The Map ====//
+    ParallelUtil::ParallelFor( nsurf, [&]( int i )
+    {
+        if ( include_surf[i] )
+        {
+            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            vector< int > & surf_ind = pnt_ind.m_SurfPntInd[i];
+            surf_ind.resize( sPntVec.size() );
+            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
             {
-                sface.m_isQuad = true;
-                int i3 = FindPntIndex( sPntVec[sFaceVec[f].ind3], allPntVec, indMap );
-                sface.ind3 = pntShift[i3];
+                surf_ind[v] = pntShift[ FindPntIndex( sPntVec[v], allPntVec, indMap ) ];
             }
-
-            sface.m_Tags = sFaceVec[f].m_Tags;
-            allFaceVec.push_back( sface );
         }
+    }, GetNumMeshThreads() );
+}
+
+//==== Open File For Writing With A Large Buffer, buf Must Outlive The File ====//
+FILE* CfdMeshMgrSingleton::OpenExportFile( const string &filename, vector< char > & buf )
+{
+    FILE* fp = fopen( filename.c_str(), "w" );
+    if ( fp )
+    {
+        buf.resize( 1 << 20 );
+        setvbuf( fp, &buf[0], _IOFBF, buf.size() );
     }
-    //==== Assemble All Used Points ====//
-    vector< vec3d* > allUsedPntVec;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    return fp;
+}
+
+void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename, const ExportPntIndex & pnt_ind )
+{
+    //==== Group Faces By Tag, In Surface Order ====//
+    map< int, vector< pair< int, int > > > tagFaceMap;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
+        vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
+        for ( int f = 0 ; f <  ( int )sFaceVec.size() ; f++ )
         {
-            allUsedPntVec.push_back( allPntVec[i] );
+            int t = SubSurfaceMgr.GetTag( sFaceVec[f].m_Tags );
+            tagFaceMap[t].push_back( pair< int, int >( i, f ) );
         }
     }
 
-    FILE* file_id = fopen( filename.c_str(), "w" );
+    const vector< vec3d* > & allUsedPntVec = pnt_ind.m_UsedPntVec;
+
+    vector< char > buf;
+    FILE* file_id = OpenExportFile( filename, buf );
     if ( file_id )
     {
         std::vector< int > tags = SubSurfaceMgr.GetAllTags();
@@ -973,49 +1110,47 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
             std::string tagname = SubSurfaceMgr.GetTagNames( itag );
             fprintf( file_id, "solid %s\n", tagname.c_str() );
 
-            for ( int f = 0; f < ( int ) allFaceVec.size(); f++ )
+            const vector< pair< int, int > > & tagFaces = tagFaceMap[ tags[itag] ];
+            for ( int k = 0; k < ( int ) tagFaces.size(); k++ )
             {
-                SimpFace* sface = &allFaceVec[f];
-                int t = SubSurfaceMgr.GetTag( sface->m_Tags );
+                const SimpFace* sface = &m_SurfVec[ tagFaces[k].first ]->GetMesh()->GetSimpFaceVec()[ tagFaces[k].second ];
+                const vector< int > & surf_ind = pnt_ind.m_SurfPntInd[ tagFaces[k].first ];
+
+                vec3d* p0 = allUsedPntVec[ surf_ind[sface->ind0] ];
+                vec3d* p1 = allUsedPntVec[ surf_ind[sface->ind1] ];
+                vec3d* p2 = allUsedPntVec[ surf_ind[sface->ind2] ];
+                vec3d v01 = *p1 - *p0;
+                vec3d v12 = *p2 - *p1;
+                vec3d norm = cross( v01, v12 );
+                norm.normalize();
+
+                fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
+                fprintf( file_id, "   outer loop\n" );
+
+                fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
+                fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1->x(), p1->y(), p1->z() );
+                fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
+
+                fprintf( file_id, "   endloop\n" );
+                fprintf( file_id, " endfacet\n" );
 
-                if ( t == tags[itag] )
+                if ( sface->m_isQuad ) // Split quad and write additional tri.
                 {
-                    vec3d* p0 = allUsedPntVec[sface->ind0];
-                    vec3d* p1 = allUsedPntVec[sface->ind1];
-                    vec3d* p2 = allUsedPntVec[sface->ind2];
-                    vec3d v01 = *p1 - *p0;
-                    vec3d v12 = *p2 - *p1;
-                    vec3d norm = cross( v01, v12 );
+                    vec3d* p3 = allUsedPntVec[ surf_ind[sface->ind3] ];
+                    vec3d v23 = *p3 - *p2;
+                    vec3d v30 = *p0 - *p3;
+                    norm = cross( v23, v30 );
                     norm.normalize();
 
                     fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
                     fprintf( file_id, "   outer loop\n" );
 
                     fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1->x(), p1->y(), p1->z() );
                     fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
+                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p3->x(), p3->y(), p3->z() );
 
                     fprintf( file_id, "   endloop\n" );
                     fprintf( file_id, " endfacet\n" );
-
-                    if ( sface->m_isQuad ) // Split quad and write additional tri.
-                    {
-                        vec3d* p3 = allUsedPntVec[sface->ind3];
-                        vec3d v23 = *p3 - *p2;
-                        vec3d v30 = *p0 - *p3;
-                        norm = cross( v23, v30 );
-                        norm.normalize();
-
-                        fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                        fprintf( file_id, "   outer loop\n" );
-
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p3->x(), p3->y(), p3->z() );
-
-                        fprintf( file_id, "   endloop\n" );
-                        fprintf( file_id, " endfacet\n" );
-                    }
                 }
             }
             fprintf( file_id, "endsolid %s\n", tagname.c_str() );
@@ -1027,7 +1162,8 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
 
 void CfdMeshMgrSingleton::WriteSTL( const string &filename )
 {
-    FILE* file_id = fopen( filename.c_str(), "w" );
+    vector< char > buf;
+    FILE* file_id = OpenExportFile( filename, buf );
     if ( file_id )
     {
         int numwake = 0;
@@ -1061,42 +1197,32 @@ void CfdMeshMgrSingleton::WriteSTL( const string &filename )
     }
 }
 
-void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
+void CfdMeshMgrSingleton::WriteTetGen( const string &filename, const ExportPntIndex & pnt_ind )
 {
-    FILE* fp = fopen( filename.c_str(), "w" );
+    vector< char > buf;
+    FILE* fp = OpenExportFile( filename, buf );
     if ( !fp )
     {
         return;
     }
 
     int face_cnt = 0;
-    vector< vec3d* > allPntVec;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-        {
-            allPntVec.push_back( &sPntVec[v] );
-        }
         face_cnt += m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec().size();
     }
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    int numPnts = BuildIndMap( allPntVec, indMap, pntShift );
+    int numPnts = pnt_ind.m_UsedPntVec.size();
 
     //===== Write Num Pnts and Tris ====//
     fprintf( fp, "# Part 1 - node list\n" );
     fprintf( fp, "%d 3 0 0\n", numPnts );
 
     //==== Write Model Pnts ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < numPnts ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, allPntVec[i]->x(), allPntVec[i]->y(), allPntVec[i]->z() );
-        }
+        vec3d* p = pnt_ind.m_UsedPntVec[i];
+        fprintf( fp, "%d %.16g %.16g %.16g\n", pnt_ind.m_UsedPntID[i] + 1, p->x(), p->y(), p->z() );
     }
 
     //==== Write Tris ====//
@@ -1107,23 +1233,19 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+        const vector< int > & surf_ind = pnt_ind.m_SurfPntInd[i];
         for ( int f = 0 ; f < ( int )sFaceVec.size() ; f++ )
         {
-            int i0 = FindPntIndex( sPntVec[sFaceVec[f].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sFaceVec[f].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sFaceVec[f].ind2], allPntVec, indMap );
-            int ind1 = pntShift[i0] + 1;
-            int ind2 = pntShift[i1] + 1;
-            int ind3 = pntShift[i2] + 1;
+            int ind1 = surf_ind[sFaceVec[f].ind0] + 1;
+            int ind2 = surf_ind[sFaceVec[f].ind1] + 1;
+            int ind3 = surf_ind[sFaceVec[f].ind2] + 1;
             int tag = SubSurfaceMgr.GetTag( sFaceVec[f].m_Tags );
 
             // <# of polygons> [# of holes] [boundary marker]
             fprintf( fp, "1 0 %d\n", tag );
             if( sFaceVec[f].m_isQuad )
             {
-                int i3 = FindPntIndex( sPntVec[sFaceVec[f].ind3], allPntVec, indMap );
-                int ind4 = pntShift[i3] + 1;
+                int ind4 = surf_ind[sFaceVec[f].ind3] + 1;
 
                 // <# of corners> <corner 1> <corner 2> <corner 3> <corner 4>
                 fprintf( fp, "4 %d %d %d %d\n", ind1, ind2, ind3, ind4 );
@@ -1193,7 +1315,8 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     fclose( fp );
 }
 
-void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn, const string & vspgeom_fn )
+void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn, const string & vspgeom_fn,
+                                                     const ExportPntIndex & body_ind, const ExportPntIndex & wake_ind )
 {
 #ifdef DEBUG_CFD_MESH
     //==== Find Smallest Edge ====//
@@ -1232,38 +1355,6 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     // Used when comparing W parameter to TMAGIC
     double tol = 1e-12;
 
-    //==== Find All Points and Tri Counts ====//
-    vector< vec3d* > allPntVec;
-    vector< vec3d* > wakeAllPntVec;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-    {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-        {
-            if ( m_SurfVec[i]->GetWakeFlag() )
-            {
-                wakeAllPntVec.push_back( &sPntVec[v] );
-            }
-            else
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
-        }
-    }
-
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
-
-    //==== Build Wake Map If Available ====//
-    map< int, vector< int > > wakeIndMap;
-    vector< int > wakePntShift;
-    if ( wakeAllPntVec.size() )
-    {
-        BuildIndMap( wakeAllPntVec, wakeIndMap, wakePntShift );
-    }
-
     //==== Assemble Normal Tris ====//
     vector< SimpFace > allFaceVec;
     int ntristrict = 0;
@@ -1275,23 +1366,19 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         if ( !m_SurfVec[i]->GetWakeFlag() )
         {
             vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             vector< vec2d >& sUWVec = m_SurfVec[i]->GetMesh()->GetSimpUWPntVec();
+            const vector< int > & surf_ind = body_ind.m_SurfPntInd[i];
             for ( int t = 0 ; t <  ( int )sFaceVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sFaceVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sFaceVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sFaceVec[t].ind2], allPntVec, indMap );
                 SimpFace sface;
-                sface.ind0 = pntShift[i0] + 1;
-                sface.ind1 = pntShift[i1] + 1;
-                sface.ind2 = pntShift[i2] + 1;
+                sface.ind0 = surf_ind[sFaceVec[t].ind0] + 1;
+                sface.ind1 = surf_ind[sFaceVec[t].ind1] + 1;
+                sface.ind2 = surf_ind[sFaceVec[t].ind2] + 1;
 
                 if( sFaceVec[t].m_isQuad )
                 {
                     sface.m_isQuad = true;
-                    int i3 = FindPntIndex( sPntVec[sFaceVec[t].ind3], allPntVec, indMap );
-                    sface.ind3 = pntShift[i3] + 1;
+                    sface.ind3 = surf_ind[sFaceVec[t].ind3] + 1;
                     ntristrict++; // Bonus tri for split quad.
                 }
 
@@ -1324,15 +1411,14 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
 
                     if ( ( n0 + n1 + n2 + n3 ) == 2 ) // Two true, one or two false.
                     {
-                        // Perform index lookup as above.
-                        int i0 = pntShift[ FindPntIndex( sPntVec[sFaceVec[t].ind0], allPntVec, indMap ) ] + 1;
-                        int i1 = pntShift[ FindPntIndex( sPntVec[sFaceVec[t].ind1], allPntVec, indMap ) ] + 1;
-                        int i2 = pntShift[ FindPntIndex( sPntVec[sFaceVec[t].ind2], allPntVec, indMap ) ] + 1;
+                        int i0 = sface.ind0;
+                        int i1 = sface.ind1;
+                        int i2 = sface.ind2;
 
                         int i3 = -1;
                         if( sFaceVec[t].m_isQuad )
                         {
-                            i3 = pntShift[ FindPntIndex( sPntVec[sFaceVec[t].ind3], allPntVec, indMap ) ] + 1;
+                            i3 = sface.ind3;
                         }
 
                         // Add nodes to wake edges, lowest u first.
@@ -1440,14 +1526,7 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
 
 
     //==== Assemble All Used Points ====//
-    vector< vec3d* > allUsedPntVec;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
-    {
-        if ( pntShift[i] >= 0 )
-        {
-            allUsedPntVec.push_back( allPntVec[i] );
-        }
-    }
+    vector< vec3d* > allUsedPntVec = body_ind.m_UsedPntVec;
 
     //==== Assemble Wake Tris ====//
     int wakeIndOffset = allUsedPntVec.size();
@@ -1456,23 +1535,19 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         if ( m_SurfVec[i]->GetWakeFlag() )
         {
             vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             vector< vec2d >& sUWVec = m_SurfVec[i]->GetMesh()->GetSimpUWPntVec();
+            const vector< int > & surf_ind = wake_ind.m_SurfPntInd[i];
             for ( int f = 0 ; f < ( int )sFaceVec.size() ; f++ )
             {
-                int i0 = FindPntIndex( sPntVec[sFaceVec[f].ind0], wakeAllPntVec, wakeIndMap );
-                int i1 = FindPntIndex( sPntVec[sFaceVec[f].ind1], wakeAllPntVec, wakeIndMap );
-                int i2 = FindPntIndex( sPntVec[sFaceVec[f].ind2], wakeAllPntVec, wakeIndMap );
                 SimpFace sface;
-                sface.ind0 = wakePntShift[i0] + 1 + wakeIndOffset;
-                sface.ind1 = wakePntShift[i1] + 1 + wakeIndOffset;
-                sface.ind2 = wakePntShift[i2] + 1 + wakeIndOffset;
+                sface.ind0 = surf_ind[sFaceVec[f].ind0] + 1 + wakeIndOffset;
+                sface.ind1 = surf_ind[sFaceVec[f].ind1] + 1 + wakeIndOffset;
+                sface.ind2 = surf_ind[sFaceVec[f].ind2] + 1 + wakeIndOffset;
 
                 if( sFaceVec[f].m_isQuad )
                 {
                     sface.m_isQuad = true;
-                    int i3 = FindPntIndex( sPntVec[sFaceVec[f].ind3], wakeAllPntVec, wakeIndMap );
-                    sface.ind3 = wakePntShift[i3] + 1 + wakeIndOffset;
+                    sface.ind3 = surf_ind[sFaceVec[f].ind3] + 1 + wakeIndOffset;
                     ntristrict++; // Bonus tri for split quad
                 }
 
@@ -1496,53 +1571,57 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     }
 
     //==== Assemble All Used Points ====//
-    for ( int i = 0 ; i < ( int )wakeAllPntVec.size() ; i++ )
-    {
-        if ( wakePntShift[i] >= 0 )
-        {
-            allUsedPntVec.push_back( wakeAllPntVec[i] );
-        }
-    }
+    allUsedPntVec.insert( allUsedPntVec.end(), wake_ind.m_UsedPntVec.begin(), wake_ind.m_UsedPntVec.end() );
+
+    //==== Formats Only Read The Assembled Faces, Write Them Together ====//
+    vector< std::function< void () > > writers;
 
     //=====================================================================================//
     //==== Write NASCART File =================================================================//
     //=====================================================================================//
     if ( dat_fn.length() != 0 )
     {
-        FILE* fp = fopen( dat_fn.c_str(), "w" );
-
-        if ( fp )
+        writers.push_back( [&]()
         {
-            //===== Write Num Pnts and Tris ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ntristrict );
+            vector< char > buf;
+            FILE* fp = OpenExportFile( dat_fn, buf );
 
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            if ( fp )
             {
-                fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
+                //===== Write Num Pnts and Tris ====//
+                fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ntristrict );
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d %d.0\n",
-                         allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind1,
-                         SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
+                //==== Write Pnts ====//
+                for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                {
+                    fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
+                }
 
-                if( allFaceVec[i].m_isQuad )
+                //==== Write Tris ====//
+                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                 {
                     fprintf( fp, "%d %d %d %d.0\n",
-                             allFaceVec[i].ind0, allFaceVec[i].ind3, allFaceVec[i].ind2,
+                             allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind1,
                              SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
+
+                    if( allFaceVec[i].m_isQuad )
+                    {
+                        fprintf( fp, "%d %d %d %d.0\n",
+                                 allFaceVec[i].ind0, allFaceVec[i].ind3, allFaceVec[i].ind2,
+                                 SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
+                    }
                 }
+                fclose( fp );
             }
-            fclose( fp );
-        }
+        } );
     }
 
     if ( key_fn.length() != 0 )
     {
-        SubSurfaceMgr.WriteNascartKeyFile( key_fn );
+        writers.push_back( [&]()
+        {
+            SubSurfaceMgr.WriteNascartKeyFile( key_fn );
+        } );
     }
 
     //=====================================================================================//
@@ -1550,31 +1629,35 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     if ( obj_fn.length() != 0 )
     {
-        FILE* fp = fopen( obj_fn.c_str(), "w" );
-
-        if ( fp )
+        writers.push_back( [&]()
         {
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
-            fprintf( fp, "\n" );
+            vector< char > buf;
+            FILE* fp = OpenExportFile( obj_fn, buf );
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+            if ( fp )
             {
-                if( allFaceVec[i].m_isQuad )
+                //==== Write Pnts ====//
+                for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
                 {
-                    fprintf( fp, "f %d %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
                 }
-                else
+                fprintf( fp, "\n" );
+
+                //==== Write Tris ====//
+                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                 {
-                    fprintf( fp, "f %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                    if( allFaceVec[i].m_isQuad )
+                    {
+                        fprintf( fp, "f %d %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    }
+                    else
+                    {
+                        fprintf( fp, "f %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                    }
                 }
+                fclose( fp );
             }
-            fclose( fp );
-        }
+        } );
     }
 
 
@@ -1583,41 +1666,45 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     if ( tri_fn.length() != 0 )
     {
-        FILE* fp = fopen( tri_fn.c_str(), "w" );
-
-        if ( fp )
+        writers.push_back( [&]()
         {
-            //==== Write Pnt Count and Tri Count ====//
-            fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ntristrict );
+            vector< char > buf;
+            FILE* fp = OpenExportFile( tri_fn, buf );
 
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            if ( fp )
             {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+                //==== Write Pnt Count and Tri Count ====//
+                fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ntristrict );
 
-            //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
-                if( allFaceVec[i].m_isQuad )
+                //==== Write Pnts ====//
+                for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
                 {
-                    fprintf( fp, "%d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
                 }
-            }
 
-            //==== Write Component ID ====//
-            for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
-            {
-                fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
-                if( allFaceVec[i].m_isQuad )
+                //==== Write Tris ====//
+                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+                {
+                    fprintf( fp, "%d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                    if( allFaceVec[i].m_isQuad )
+                    {
+                        fprintf( fp, "%d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    }
+                }
+
+                //==== Write Component ID ====//
+                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                 {
                     fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
+                    if( allFaceVec[i].m_isQuad )
+                    {
+                        fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ) );
+                    }
                 }
-            }
 
-            fclose( fp );
-        }
+                fclose( fp );
+            }
+        } );
     }
 
     //=====================================================================================//
@@ -1625,44 +1712,48 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     if ( gmsh_fn.length() != 0 )
     {
-        FILE* fp = fopen( gmsh_fn.c_str(), "w" );
-        if ( fp )
+        writers.push_back( [&]()
         {
-            fprintf( fp, "$MeshFormat\n" );
-            fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
-            fprintf( fp, "$EndMeshFormat\n" );
-
-            //==== Write Nodes ====//
-            fprintf( fp, "$Nodes\n" );
-            fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            vector< char > buf;
+            FILE* fp = OpenExportFile( gmsh_fn, buf );
+            if ( fp )
             {
-                fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
-                         allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
-            fprintf( fp, "$EndNodes\n" );
+                fprintf( fp, "$MeshFormat\n" );
+                fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
+                fprintf( fp, "$EndMeshFormat\n" );
 
-            //==== Write Tris ====//
-            fprintf( fp, "$Elements\n" );
-            fprintf( fp, "%d\n", ( int )allFaceVec.size() );
-
-            int ele_cnt = 1;
-            for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
-            {
-                if( allFaceVec[i].m_isQuad )
+                //==== Write Nodes ====//
+                fprintf( fp, "$Nodes\n" );
+                fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
+                for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
                 {
-                    fprintf( fp, "%d 3 0 %d %d %d %d \n", ele_cnt, allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
+                             allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
                 }
-                else
+                fprintf( fp, "$EndNodes\n" );
+
+                //==== Write Tris ====//
+                fprintf( fp, "$Elements\n" );
+                fprintf( fp, "%d\n", ( int )allFaceVec.size() );
+
+                int ele_cnt = 1;
+                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                 {
-                    fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                    if( allFaceVec[i].m_isQuad )
+                    {
+                        fprintf( fp, "%d 3 0 %d %d %d %d \n", ele_cnt, allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                    }
+                    else
+                    {
+                        fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                    }
+                    ele_cnt++;
                 }
-                ele_cnt++;
-            }
 
-            fprintf( fp, "$EndElements\n" );
-            fclose( fp );
-        }
+                fprintf( fp, "$EndElements\n" );
+                fclose( fp );
+            }
+        } );
     }
 
     //=====================================================================================//
@@ -1670,155 +1761,145 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     if ( vspgeom_fn.length() != 0 )
     {
-        FILE* fp = fopen( vspgeom_fn.c_str(), "w" );
-
-        if ( fp )
+        writers.push_back( [&]()
         {
-            //==== Write Pnt Count ====//
-            fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
+            vector< char > buf;
+            FILE* fp = OpenExportFile( vspgeom_fn, buf );
 
-            //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+            if ( fp )
             {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+                //==== Write Pnt Count ====//
+                fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
 
-            bool allowquads = true;
-            if ( allowquads )
-            {
-                //==== Write Face Count ====//
-                fprintf( fp, "%d\n", ( int )allFaceVec.size() );
+                //==== Write Pnts ====//
+                for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
+                {
+                    fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
+                }
 
-                //==== Write Faces ====//
-                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+                bool allowquads = true;
+                if ( allowquads )
                 {
-                    if( allFaceVec[i].m_isQuad )
-                    {
-                        fprintf( fp, "4 %d %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
-                    }
-                    else
+                    //==== Write Face Count ====//
+                    fprintf( fp, "%d\n", ( int )allFaceVec.size() );
+
+                    //==== Write Faces ====//
+                    for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                     {
-                        fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                        if( allFaceVec[i].m_isQuad )
+                        {
+                            fprintf( fp, "4 %d %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                        }
+                        else
+                        {
+                            fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                        }
                     }
                 }
-            }
-            else
-            {
-                //==== Write Face Count ====//
-                fprintf( fp, "%d\n", ntristrict );
-
-                //==== Write Tris Only ====//
-                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+                else
                 {
-                    fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
-                    if( allFaceVec[i].m_isQuad )
+                    //==== Write Face Count ====//
+                    fprintf( fp, "%d\n", ntristrict );
+
+                    //==== Write Tris Only ====//
+                    for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                     {
-                        fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                        fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind1, allFaceVec[i].ind2 );
+                        if( allFaceVec[i].m_isQuad )
+                        {
+                            fprintf( fp, "3 %d %d %d \n", allFaceVec[i].ind0, allFaceVec[i].ind2, allFaceVec[i].ind3 );
+                        }
                     }
                 }
-            }
 
-            if ( allowquads )
-            {
-                //==== Write Component ID ====//
-                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+                if ( allowquads )
                 {
-                    if( allFaceVec[i].m_isQuad )
-                    {
-                        fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
-                             allUWVec[i][0].x(), allUWVec[i][0].y(),
-                             allUWVec[i][1].x(), allUWVec[i][1].y(),
-                             allUWVec[i][2].x(), allUWVec[i][2].y(),
-                             allUWVec[i][3].x(), allUWVec[i][3].y() );
-                    }
-                    else
+                    //==== Write Component ID ====//
+                    for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                     {
-                        fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
+                        if( allFaceVec[i].m_isQuad )
+                        {
+                            fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
                                  allUWVec[i][0].x(), allUWVec[i][0].y(),
                                  allUWVec[i][1].x(), allUWVec[i][1].y(),
-                                 allUWVec[i][2].x(), allUWVec[i][2].y() );
+                                 allUWVec[i][2].x(), allUWVec[i][2].y(),
+                                 allUWVec[i][3].x(), allUWVec[i][3].y() );
+                        }
+                        else
+                        {
+                            fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
+                                     allUWVec[i][0].x(), allUWVec[i][0].y(),
+                                     allUWVec[i][1].x(), allUWVec[i][1].y(),
+                                     allUWVec[i][2].x(), allUWVec[i][2].y() );
+                        }
                     }
                 }
-            }
-            else
-            {
-                //==== Write Component ID ====//
-                for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
+                else
                 {
-                    fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
-                             allUWVec[i][0].x(), allUWVec[i][0].y(),
-                             allUWVec[i][1].x(), allUWVec[i][1].y(),
-                             allUWVec[i][2].x(), allUWVec[i][2].y() );
-                    if( allFaceVec[i].m_isQuad )
+                    //==== Write Component ID ====//
+                    for ( int i = 0 ; i < ( int )allFaceVec.size() ; i++ )
                     {
                         fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
                                  allUWVec[i][0].x(), allUWVec[i][0].y(),
-                                 allUWVec[i][2].x(), allUWVec[i][2].y(),
-                                 allUWVec[i][3].x(), allUWVec[i][3].y() );
+                                 allUWVec[i][1].x(), allUWVec[i][1].y(),
+                                 allUWVec[i][2].x(), allUWVec[i][2].y() );
+                        if( allFaceVec[i].m_isQuad )
+                        {
+                            fprintf( fp, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", SubSurfaceMgr.GetTag( allFaceVec[i].m_Tags ),
+                                     allUWVec[i][0].x(), allUWVec[i][0].y(),
+                                     allUWVec[i][2].x(), allUWVec[i][2].y(),
+                                     allUWVec[i][3].x(), allUWVec[i][3].y() );
+                        }
                     }
                 }
-            }
 
-            int nwake = wakes.size();
-            // Wake line data.
-            fprintf( fp, "%d\n", nwake );
+                int nwake = wakes.size();
+                // Wake line data.
+                fprintf( fp, "%d\n", nwake );
 
-            for ( int iwake = 0; iwake < nwake; iwake++ )
-            {
-
-                int iprt = 0;
-                int iwe;
-                int nwe = wakes[iwake].size();
-                fprintf( fp, "%d ", nwe + 1 );
-                for ( iwe = 0; iwe < nwe; iwe++ )
+                for ( int iwake = 0; iwake < nwake; iwake++ )
                 {
-                    fprintf( fp, "%d", wakes[iwake][iwe].first );
 
-                    if ( iprt < 9 )
-                    {
-                        fprintf( fp, " " );
-                        iprt++;
-                    }
-                    else
+                    int iprt = 0;
+                    int iwe;
+                    int nwe = wakes[iwake].size();
+                    fprintf( fp, "%d ", nwe + 1 );
+                    for ( iwe = 0; iwe < nwe; iwe++ )
                     {
-                        fprintf( fp, "\n" );
-                        iprt = 0;
+                        fprintf( fp, "%d", wakes[iwake][iwe].first );
+
+                        if ( iprt < 9 )
+                        {
+                            fprintf( fp, " " );
+                            iprt++;
+                        }
+                        else
+                        {
+                            fprintf( fp, "\n" );
+                            iprt = 0;
+                        }
                     }
+                    fprintf( fp, "%d\n", wakes[iwake][iwe-1].second );
+
                 }
-                fprintf( fp, "%d\n", wakes[iwake][iwe-1].second );
 
+                fclose( fp );
             }
 
-            fclose( fp );
-        }
-
-        SubSurfaceMgr.WriteVSPGEOMKeyFile( vspgeom_fn );
+            SubSurfaceMgr.WriteVSPGEOMKeyFile( vspgeom_fn );
+        } );
     }
+
+    ParallelUtil::ParallelFor( ( int )writers.size(), [&]( int i )
+    {
+        writers[i]();
+    }, GetNumMeshThreads() );
 }
 
-void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
+void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn, const ExportPntIndex & pnt_ind )
 {
     // Note: Wake mesh not included in Facet export
 
-    //==== Find All Points and Tri Counts ====//
-    vector< vec3d* > allPntVec;
-    for ( int i = 0; i < (int)m_SurfVec.size(); i++ )
-    {
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0; v < (int)sPntVec.size(); v++ )
-        {
-            if ( !m_SurfVec[i]->GetWakeFlag() )
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
-        }
-    }
-
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
-
     //==== Assemble Normal Tris ====//
     vector< SimpFace > allFaceVec;
     for ( int i = 0; i < (int)m_SurfVec.size(); i++ )
@@ -1826,43 +1907,33 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
         if ( !m_SurfVec[i]->GetWakeFlag() )
         {
             vector < SimpFace >& sFaceVec = m_SurfVec[ i ]->GetMesh()->GetSimpFaceVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            const vector< int > & surf_ind = pnt_ind.m_SurfPntInd[i];
             for ( int f = 0; f < (int)sFaceVec.size(); f++ )
             {
-                int i0 = FindPntIndex( sPntVec[sFaceVec[f].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sFaceVec[f].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sFaceVec[f].ind2], allPntVec, indMap );
                 SimpFace sface;
-                sface.ind0 = pntShift[i0] + 1;
-                sface.ind1 = pntShift[i1] + 1;
-                sface.ind2 = pntShift[i2] + 1;
+                sface.ind0 = surf_ind[sFaceVec[f].ind0] + 1;
+                sface.ind1 = surf_ind[sFaceVec[f].ind1] + 1;
+                sface.ind2 = surf_ind[sFaceVec[f].ind2] + 1;
                 sface.m_Tags = sFaceVec[f].m_Tags;
                 if ( sFaceVec[f].m_isQuad )
                 {
                     sface.m_isQuad = true;
-                    int i3 = FindPntIndex( sPntVec[sFaceVec[f].ind3], allPntVec, indMap );
-                    sface.ind3 = pntShift[i3] + 1;
+                    sface.ind3 = surf_ind[sFaceVec[f].ind3] + 1;
                 }
                 allFaceVec.push_back( sface );
             }
         }
     }
     //==== Assemble All Used Points ====//
-    vector< vec3d* > allUsedPntVec;
-    for ( int i = 0; i < (int)allPntVec.size(); i++ )
-    {
-        if ( pntShift[i] >= 0 )
-        {
-            allUsedPntVec.push_back( allPntVec[i] );
-        }
-    }
+    const vector< vec3d* > & allUsedPntVec = pnt_ind.m_UsedPntVec;
 
     //=====================================================================================//
     //==== Write Facet File for Xpatch ====================================================//
     //=====================================================================================//
     if ( facet_fn.length() != 0 )
     {
-        FILE* fp = fopen( facet_fn.c_str(), "w" );
+        vector< char > buf;
+        FILE* fp = OpenExportFile( facet_fn, buf );
 
         if ( fp )
         {
@@ -2506,28 +2577,40 @@ void CfdMeshMgrSingleton::InitMesh( )
 void CfdMeshMgrSingleton::TessellateChains()
 {
     //==== Tessellate Chains ====//
-    list< ISegChain* >::iterator c;
-    for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
+    vector< ISegChain* > chains( m_ISegChainList.begin(), m_ISegChainList.end() );
+    vector< IPntPool > pool_vec( chains.size() );
+
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
-        if( ( *c )->GetWakeAttachChain() == NULL ) // Non wake-attach chains.
+        if( chains[i]->GetWakeAttachChain() == NULL ) // Non wake-attach chains.
         {
-            ( *c )->Tessellate();
-            ( *c )->TransferTess();
-            ( *c )->ApplyTess( this );
+            chains[i]->Tessellate();
+            chains[i]->TransferTess();
+            chains[i]->ApplyTess( &pool_vec[i] );
         }
+    }, GetNumMeshThreads() );
+
+    for ( int i = 0 ; i < ( int )pool_vec.size() ; i++ )
+    {
+        AddDelPool( pool_vec[i] );
+        pool_vec[i] = IPntPool();
     }
 
-    for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
-        if( ( *c )->GetWakeAttachChain() != NULL ) // Only wake-attach chains.
+        if( chains[i]->GetWakeAttachChain() != NULL ) // Only wake-attach chains.
         {
-            vector< double > u = ( *c )->GetWakeAttachChain()->m_ACurve.GetUTessPnts();
-            ( *c )->m_ACurve.Tesselate( u ); // Copy tessellation from matching chain.
-            ( *c )->TransferTess();
-            ( *c )->ApplyTess( this );
+            vector< double > u = chains[i]->GetWakeAttachChain()->m_ACurve.GetUTessPnts();
+            chains[i]->m_ACurve.Tesselate( u ); // Copy tessellation from matching chain.
+            chains[i]->TransferTess();
+            chains[i]->ApplyTess( &pool_vec[i] );
         }
-    }
+    }, GetNumMeshThreads() );
 
+    for ( int i = 0 ; i < ( int )pool_vec.size() ; i++ )
+    {
+        AddDelPool( pool_vec[i] );
+    }
 
     ////==== Check for Zero Length Chains ====//
     //for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); c++ )
@@ -2771,28 +2854,39 @@ void CfdMeshMgrSingleton::MergeEndPointCloud( IPntCloud &cloud, double tol )
 
 void CfdMeshMgrSingleton::BuildMesh()
 {
-    char str[256];
+    int nsurf = ( int )m_SurfVec.size();
 
-    //==== Mesh Each Surface ====//
-    for ( int s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
+    //==== Gather Chains And Fix Points For Each Surface ====//
+    vector< vector< ISegChain* > > surf_chains( nsurf );
+    vector< vector < vec2d > > adduw( nsurf );
+    for ( int s = 0 ; s < nsurf ; s++ )
     {
-        vector< ISegChain* > surf_chains;
         list< ISegChain* >::iterator c;
         for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
         {
             if ( ( ( *c )->m_SurfA == m_SurfVec[s] || ( *c )->m_SurfB == m_SurfVec[s] ) )
             {
-                surf_chains.push_back( ( *c ) );
+                surf_chains[s].push_back( ( *c ) );
             }
         }
 
-        vector < vec2d > adduw;
-        ForceSurfaceFixPoints( s, adduw );
+        ForceSurfaceFixPoints( s, adduw[s] );
+    }
 
-        sprintf( str, _("InitMesh %d/%d\n"), s+1, m_SurfVec.size() );
+    //==== Mesh Each Surface ====//
+    // Border chains are already tessellated, so each surface mesh is independent.
+    int num_done = 0;
+    std::mutex progress_mutex;
+    ParallelUtil::ParallelFor( nsurf, [&]( int s )
+    {
+        m_SurfVec[s]->InitMesh( surf_chains[s], adduw[s], this );
+
+        char str[256];
+        std::lock_guard< std::mutex > lock( progress_mutex );
+        num_done++;
+        sprintf( str, _("InitMesh %d/%d\n"), num_done, nsurf );
         addOutputText( str );
-        m_SurfVec[s]->InitMesh( surf_chains, adduw, this );
-    }
+    }, GetNumMeshThreads() );
 }
 
 // Determines if a triangle should be deleted based on its type and whether or not it is inside every other surface
@@ -21,7 +21,8 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patches, keep splitting till planer, intersect.
+//      Surf::CheckIntersect - find surface pairs, SurfPatchBox - find overlapping patches.
+//      intersect - keep splitting patch pairs till planer, intersect.
 //          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
@@ -46,6 +47,7 @@
 //              Remove intierior triangles.
 //
 //      CfdMeshMgr::Remesh: Remesh (split, collapse, swap, smooth) each surface mesh triangle.
+//              Surfaces whose initial mesh and target map match the last mesh reuse its result.
 //
 
 
@@ -80,6 +82,15 @@
 #include <string>
 using namespace std;
 
+//==== Merged Points Of The Surface Meshes, Shared By The Export Writers ====//
+class ExportPntIndex
+{
+public:
+    vector< vec3d* > m_UsedPntVec;          // One point for each merged index
+    vector< int > m_UsedPntID;              // Position of each used point among all included points
+    vector< vector< int > > m_SurfPntInd;   // Merged index of each SimpPnt, empty for excluded surfaces
+};
+
 //////////////////////////////////////////////////////////////////////
 class CfdMeshMgrSingleton : public SurfaceIntersectionSingleton
 {
@@ -150,16 +161,19 @@ public:
     void UpdateDisplaySettings() override;
 
     virtual void WriteSTL( const string &filename );
-    virtual void WriteTaggedSTL( const string &filename );
-    virtual void WriteTetGen( const string &filename );
-    virtual void WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn, const string & vspgeom_fn );
-    virtual void WriteFacet( const string &facet_fn );
+    virtual void WriteTaggedSTL( const string &filename, const ExportPntIndex & pnt_ind );
+    virtual void WriteTetGen( const string &filename, const ExportPntIndex & pnt_ind );
+    virtual void WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const string &key_fn, const string &obj_fn, const string &tri_fn, const string &gmsh_fn, const string & vspgeom_fn,
+                                            const ExportPntIndex & body_ind, const ExportPntIndex & wake_ind );
+    virtual void WriteFacet( const string &facet_fn, const ExportPntIndex & pnt_ind );
 
     void ExportFiles() override;
     //virtual void CheckDupOrAdd( Node* node, vector< Node* > & nodeVec );
     virtual int BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift );
     virtual int  FindPntIndex( vec3d& pnt, vector< vec3d* > & allPntVec,
                                map< int, vector< int > >& indMap );
+    virtual void BuildExportPntIndex( const vector< bool > & include_surf, ExportPntIndex & pnt_ind );
+    static FILE* OpenExportFile( const string &filename, vector< char > & buf );
 
     virtual string CheckWaterTight();
     virtual Edge* FindAddEdge( map< int, vector<Edge*> > & edgeMap, vector< Node* > & nodeVec, int ind1, int ind2 );
@@ -235,6 +249,12 @@ protected:
     vector<Face*> m_BadFaces;
     vector< Node* > m_nodeStore;
 
+    // Target map points and curvature lengths from the last mesh, keyed by Surf::GetCurvMapKey
+    map< vector< double >, CurvTargetMap > m_CurvMapCache;
+
+    // Remeshed surfaces from the last mesh, keyed by Mesh::GetRemeshKey of the initial mesh
+    map< vector< double >, MeshData > m_RemeshCache;
+
 private:
     DrawObj m_MeshBadEdgeDO;
     DrawObj m_MeshBadTriDO;
@@ -62,7 +62,7 @@ int FeaNode::GetIndex()
     return m_Index;
 }
 
-void FeaNode::WriteNASTRAN( FILE* fp, int noffset )
+void FeaNode::WriteNASTRAN( string & buf, int noffset )
 {
     double x = m_Pnt.x();
     double y = m_Pnt.y();
@@ -71,23 +71,23 @@ void FeaNode::WriteNASTRAN( FILE* fp, int noffset )
     string bcstr = m_BCs.AsNASTRAN();
 
     string fmt = "GRID    ,%8d,        ," + NasFmt( x ) + "," + NasFmt( y ) + "," + NasFmt( z ) + ",        ,%s\n";
-    fprintf( fp, fmt.c_str(), m_Index + noffset, x, y, z, bcstr.c_str() );
+    append_format( buf, fmt.c_str(), m_Index + noffset, x, y, z, bcstr.c_str() );
 }
 
-void FeaNode::WriteCalculix( FILE* fp, int noffset )
+void FeaNode::WriteCalculix( string & buf, int noffset )
 {
     if ( true )   // print 'just' nodes.
     {
-        fprintf( fp, "%d,%f,%f,%f\n", m_Index + noffset, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+        append_format( buf, "%d,%f,%f,%f\n", m_Index + noffset, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
     }
     else          // also print node tags for debugging.
     {
-        fprintf( fp, "%d,%f,%f,%f  ** ", m_Index + noffset, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+        append_format( buf, "%d,%f,%f,%f  ** ", m_Index + noffset, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
         for ( int i = 0; i < m_Tags.size(); i++ )
         {
-            fprintf( fp, "%d ", m_Tags[ i ] );
+            append_format( buf, "%d ", m_Tags[ i ] );
         }
-        fprintf( fp, "\n" );
+        append_format( buf, "\n" );
     }
 }
 
@@ -178,22 +178,22 @@ void FeaTri::Create( vec3d & p0, vec3d & p1, vec3d & p2, bool highorder )
     }
 }
 
-void FeaTri::WriteCalculix( FILE* fp, int id, int noffset, int eoffset )
+void FeaTri::WriteCalculix( string & buf, int id, int noffset, int eoffset )
 {
     if ( m_ElementType == FEA_TRI_3 )
     {
-        fprintf( fp, "%d,%d,%d,%d\n", id + eoffset,
+        append_format( buf, "%d,%d,%d,%d\n", id + eoffset,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset );
     }
     else
     {
-        fprintf( fp, "%d,%d,%d,%d,%d,%d,%d\n", id + eoffset,
+        append_format( buf, "%d,%d,%d,%d,%d,%d,%d\n", id + eoffset,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset,
                  m_Mids[0]->GetIndex() + noffset, m_Mids[1]->GetIndex() + noffset, m_Mids[2]->GetIndex() + noffset );
     }
 }
 
-void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset )
+void FeaTri::WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset )
 {
     vec3d x_element = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
     x_element.normalize();
@@ -205,7 +205,7 @@ void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, in
     {
         string format_string = "CTRIA3  ,%8d,%8d,%8d,%8d,%8d," + NasFmt( theta_material ) + "\n";
 
-        fprintf( fp, format_string.c_str(), id + eoffset, property_index + 1,
+        append_format( buf, format_string.c_str(), id + eoffset, property_index + 1,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset,
                  theta_material );
     }
@@ -213,7 +213,7 @@ void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, in
     {
         string format_string = "CTRIA6  ,%8d,%8d,%8d,%8d,%8d,%8d,%8d,%8d,\n        ," + NasFmt( theta_material ) + "\n";
 
-        fprintf( fp, format_string.c_str(), id + eoffset, property_index + 1,
+        append_format( buf, format_string.c_str(), id + eoffset, property_index + 1,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset,
                  m_Mids[0]->GetIndex() + noffset, m_Mids[1]->GetIndex() + noffset, m_Mids[2]->GetIndex() + noffset, theta_material );
     }
@@ -323,21 +323,21 @@ void FeaQuad::Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3, bool higho
     }
 }
 
-void FeaQuad::WriteCalculix( FILE* fp, int id, int noffset, int eoffset )
+void FeaQuad::WriteCalculix( string & buf, int id, int noffset, int eoffset )
 {
     if ( m_ElementType == FEA_QUAD_4 )
     {
-        fprintf( fp, "%d,%d,%d,%d,%d\n", id + eoffset,
+        append_format( buf, "%d,%d,%d,%d,%d\n", id + eoffset,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset, m_Corners[3]->GetIndex() + noffset );
     }
     else
     {
-        fprintf( fp, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id + eoffset,
+        append_format( buf, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id + eoffset,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset, m_Corners[3]->GetIndex() + noffset,
                  m_Mids[0]->GetIndex() + noffset, m_Mids[1]->GetIndex() + noffset, m_Mids[2]->GetIndex() + noffset, m_Mids[3]->GetIndex() + noffset );
     }
 }
-void FeaQuad::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset )
+void FeaQuad::WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset )
 {
     vec3d x_element = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
     x_element.normalize();
@@ -349,14 +349,14 @@ void FeaQuad::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, i
     {
         string format_string = "CQUAD4  ,%8d,%8d,%8d,%8d,%8d,%8d," + NasFmt( theta_material ) + "\n";
 
-        fprintf( fp, format_string.c_str(), id + eoffset, property_index + 1,
+        append_format( buf, format_string.c_str(), id + eoffset, property_index + 1,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset, m_Corners[3]->GetIndex() + noffset, theta_material );
     }
     else
     {
         string format_string = "CQUAD8  ,%8d,%8d,%8d,%8d,%8d,%8d,%8d,%8d,\n        ,%8d,%8d,        ,        ,        ,        ," + NasFmt( theta_material ) + "\n";
 
-        fprintf( fp, format_string.c_str(), id + eoffset, property_index + 1,
+        append_format( buf, format_string.c_str(), id + eoffset, property_index + 1,
                  m_Corners[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset, m_Corners[2]->GetIndex() + noffset, m_Corners[3]->GetIndex() + noffset,
                  m_Mids[0]->GetIndex() + noffset, m_Mids[1]->GetIndex() + noffset, m_Mids[2]->GetIndex() + noffset, m_Mids[3]->GetIndex() + noffset, theta_material );
 
@@ -473,22 +473,22 @@ void FeaBeam::Create( vec3d &p0, vec3d &p1, vec3d &norm0, vec3d &norm1 )
     m_Norm1 = norm1;
 }
 
-void FeaBeam::WriteCalculix( FILE* fp, int id, int noffset, int eoffset )
+void FeaBeam::WriteCalculix( string & buf, int id, int noffset, int eoffset )
 {
-    fprintf( fp, "%d,%d,%d,%d\n", id + eoffset,
+    append_format( buf, "%d,%d,%d,%d\n", id + eoffset,
              m_Corners[0]->GetIndex() + noffset, m_Mids[0]->GetIndex() + noffset, m_Corners[1]->GetIndex() + noffset );
 
     m_ElementIndex = id; // Save element index 
 }
 
-void FeaBeam::WriteCalculixNormal( FILE* fp, int noffset, int eoffset )
+void FeaBeam::WriteCalculixNormal( string & buf, int noffset, int eoffset )
 {
     vec3d norm = ( m_Norm0 + m_Norm1 ) * 0.5;
     norm.normalize();
 
-    fprintf( fp, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Corners[0]->GetIndex() + noffset, m_Norm0.x(), m_Norm0.y(), m_Norm0.z() );
-    fprintf( fp, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Mids[0]->GetIndex() + noffset, norm.x(), norm.y(), norm.z() );
-    fprintf( fp, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Corners[1]->GetIndex() + noffset, m_Norm1.x(), m_Norm1.y(), m_Norm1.z() );
+    append_format( buf, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Corners[0]->GetIndex() + noffset, m_Norm0.x(), m_Norm0.y(), m_Norm0.z() );
+    append_format( buf, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Mids[0]->GetIndex() + noffset, norm.x(), norm.y(), norm.z() );
+    append_format( buf, "%d,%d,%f,%f,%f\n", m_ElementIndex + eoffset, m_Corners[1]->GetIndex() + noffset, m_Norm1.x(), m_Norm1.y(), m_Norm1.z() );
 }
 
 void FeaBeam::WriteCalculixNormal( FILE* fp )
@@ -496,12 +496,12 @@ void FeaBeam::WriteCalculixNormal( FILE* fp )
     fprintf( fp, "%f,%f,%f\n", m_Norm0.x(), m_Norm0.y(), m_Norm0.z() );
 }
 
-void FeaBeam::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset )
+void FeaBeam::WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset )
 {
     string format_string = "CBAR    ,%8d,%8d,%8d,%8d," + NasFmt( m_Norm0.x() ) + "," +
                            NasFmt( m_Norm0.y() ) + "," + NasFmt( m_Norm0.z() ) + "\n";
 
-    fprintf( fp, format_string.c_str(), id + eoffset, property_index + 1, m_Corners[0]->GetIndex() + noffset,
+    append_format( buf, format_string.c_str(), id + eoffset, property_index + 1, m_Corners[0]->GetIndex() + noffset,
              m_Corners[1]->GetIndex() + noffset, m_Norm0.x(), m_Norm0.y(), m_Norm0.z() );
 }
 
@@ -563,17 +563,17 @@ void FeaPointMass::Create( vec3d & p0, double mass )
     m_Mass = mass;
 }
 
-void FeaPointMass::WriteCalculix( FILE* fp, int id, int noffset, int eoffset )
+void FeaPointMass::WriteCalculix( string & buf, int id, int noffset, int eoffset )
 {
-    fprintf( fp, "%d,%d\n", id + eoffset, m_Corners[0]->GetIndex() + noffset );
+    append_format( buf, "%d,%d\n", id + eoffset, m_Corners[0]->GetIndex() + noffset );
 }
 
-void FeaPointMass::WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset )
+void FeaPointMass::WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset )
 {
     // Note: property_index ignored
     string format_string = "CONM2   ,%8d,%8d,        ," + NasFmt( m_Mass ) + "\n";
 
-    fprintf( fp, format_string.c_str(), id + eoffset, m_Corners[0]->GetIndex() + noffset, m_Mass );
+    append_format( buf, format_string.c_str(), id + eoffset, m_Corners[0]->GetIndex() + noffset, m_Mass );
 }
 
 //////////////////////////////////////////////////////
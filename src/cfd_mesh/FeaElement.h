@@ -49,8 +49,8 @@ public:
     bool HasOnlyTag( int ind );
     vector< int > m_Tags;
 
-    void WriteNASTRAN( FILE* fp, int noffset );
-    void WriteCalculix( FILE* fp, int noffset );
+    void WriteNASTRAN( string & buf, int noffset );
+    void WriteCalculix( string & buf, int noffset );
     void WriteCalculixBCs( FILE* fp, int noffset );
     void WriteGmsh( FILE* fp, int noffset );
 };
@@ -84,8 +84,8 @@ public:
     {
         m_FeaPartSurfNum = part_surf_num;
     }
-    virtual void WriteCalculix( FILE* fp, int id, int noffset, int eoffset ) = 0;
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset ) = 0;
+    virtual void WriteCalculix( string & buf, int id, int noffset, int eoffset ) = 0;
+    virtual void WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset ) = 0;
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, int noffset, int eoffset ) = 0;
     virtual void WriteSTL( FILE* fp ) = 0;
     virtual double ComputeMass( int property_index ) = 0;
@@ -123,8 +123,8 @@ public:
     virtual ~FeaTri()    {};
 
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, bool highorder );
-    virtual void WriteCalculix( FILE* fp, int id, int noffset, int eoffset );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset );
+    virtual void WriteCalculix( string & buf, int id, int noffset, int eoffset );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, int noffset, int eoffset );
     virtual void WriteSTL( FILE* fp );
     virtual double ComputeMass( int property_index );
@@ -138,8 +138,8 @@ public:
     virtual ~FeaQuad()    {};
 
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3, bool highorder );
-    virtual void WriteCalculix( FILE* fp, int id, int noffset, int eoffset );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset );
+    virtual void WriteCalculix( string & buf, int id, int noffset, int eoffset );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, int noffset, int eoffset );
     virtual void WriteSTL( FILE* fp );
     virtual double ComputeMass( int property_index );
@@ -153,10 +153,10 @@ public:
     virtual ~FeaBeam()    {};
 
     virtual void Create( vec3d &p0, vec3d &p1, vec3d &norm0, vec3d &norm1 );
-    virtual void WriteCalculix( FILE* fp, int id, int noffset, int eoffset );
-    virtual void WriteCalculixNormal( FILE* fp, int noffset, int eoffset );
+    virtual void WriteCalculix( string & buf, int id, int noffset, int eoffset );
+    virtual void WriteCalculixNormal( string & buf, int noffset, int eoffset );
     virtual void WriteCalculixNormal( FILE* fp );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, int noffset, int eoffset );
     virtual void WriteSTL( FILE* fp ) {};
     virtual double ComputeMass( int property_index );
@@ -177,8 +177,8 @@ public:
     virtual ~FeaPointMass()    {};
 
     virtual void Create( vec3d & p0, double mass );
-    virtual void WriteCalculix( FILE* fp, int id, int noffset, int eoffset );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index, int noffset, int eoffset );
+    virtual void WriteCalculix( string & buf, int id, int noffset, int eoffset );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index, int noffset, int eoffset );
     virtual void WriteGmsh( FILE* fp, int id, int fea_part_index, int noffset, int eoffset )    {};
     virtual void WriteSTL( FILE* fp ) {};
     virtual double ComputeMass( int property_index )
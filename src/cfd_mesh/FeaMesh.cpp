@@ -845,12 +845,14 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
     if ( fp && temp )
     {
         vector < int > node_id_vec;
+        vector < int > node_ind_vec;
         string name;
 
         // FeaPart Nodes
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
         {
             node_id_vec.clear();
+            node_ind_vec.clear();
 
             fprintf( temp, "\n" );
             fprintf( temp, "$ %s %s Gridpoints\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
@@ -863,12 +865,13 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
                     {
                         if ( m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
                         {
-                            m_FeaNodeVec[j]->WriteNASTRAN( temp, noffset );
+                            node_ind_vec.push_back( j );
                             node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
                         }
                     }
                 }
             }
+            WriteNASTRANNodeCards( temp, node_ind_vec, noffset );
 
             // Write FEA part node set
             name = m_FeaPartNameVec[i] + "_" + m_StructName + "_Gridpoints";
@@ -878,6 +881,7 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
         {
             node_id_vec.clear();
+            node_ind_vec.clear();
 
             if ( m_FeaPartTypeVec[i] == vsp::FEA_FIX_POINT ) // FixedPoint Nodes
             {
@@ -887,12 +891,13 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
                     {
                         if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && m_FeaNodeVec[j]->m_FixedPointFlag && m_FeaNodeVec[j]->HasTag( i ) )
                         {
-                            m_FeaNodeVec[j]->WriteNASTRAN( temp, noffset );
+                            node_ind_vec.push_back( j );
                             node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
                         }
                     }
                 }
             }
+            WriteNASTRANNodeCards( temp, node_ind_vec, noffset );
 
             // Write FEA part node set
             name = m_FeaPartNameVec[i] + "_" + m_StructName + "_FixedGridpoints";
@@ -906,6 +911,7 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
             fprintf( temp, "$ %s %s Gridpoints\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
 
             node_id_vec.clear();
+            node_ind_vec.clear();
 
             for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
             {
@@ -913,11 +919,12 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
                 {
                     if ( m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
                     {
-                        m_FeaNodeVec[j]->WriteNASTRAN( temp, noffset );
+                        node_ind_vec.push_back( j );
                         node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
                     }
                 }
             }
+            WriteNASTRANNodeCards( temp, node_ind_vec, noffset );
 
             // Write subsurface node set
             name = m_SimpleSubSurfaceVec[i].GetName() + "_" + m_StructName + "_Gridpoints";
@@ -925,52 +932,54 @@ void FeaMesh::WriteNASTRANNodes( FILE* fp, FILE* temp, FILE* nkey_fp, int &set_c
         }
 
         node_id_vec.clear();
+        node_ind_vec.clear();
 
         // Intersection Nodes
-        bool IntersectHeader = false;
         for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
         {
             if ( m_PntShift[j] >= 0 )
             {
                 if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
                 {
-                    if ( !IntersectHeader )
-                    {
-                        fprintf( temp, "\n" );
-                        fprintf( temp, "$ %s Intersections\n", m_StructName.c_str() );
-                        IntersectHeader = true;
-                    }
-                    m_FeaNodeVec[j]->WriteNASTRAN( temp, noffset );
+                    node_ind_vec.push_back( j );
                     node_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
                 }
             }
         }
 
+        if ( node_ind_vec.size() > 0 )
+        {
+            fprintf( temp, "\n" );
+            fprintf( temp, "$ %s Intersections\n", m_StructName.c_str() );
+        }
+        WriteNASTRANNodeCards( temp, node_ind_vec, noffset );
+
         // Write intersection node set
         name = m_StructName + "_Intersection_Gridpoints";
         WriteNASTRANSet( fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
 
         node_id_vec.clear();
+        node_ind_vec.clear();
 
         //==== Remaining Nodes ====//
-        bool RemainingHeader = false;
         for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
         {
             node_id_vec.clear();
 
             if ( m_PntShift[i] >= 0 && m_FeaNodeVec[i]->m_Tags.size() == 0 )
             {
-                if ( !RemainingHeader )
-                {
-                    fprintf( temp, "\n" );
-                    fprintf( temp, "$ %s Remainingnodes\n", m_StructName.c_str() );
-                    RemainingHeader = true;
-                }
-                m_FeaNodeVec[i]->WriteNASTRAN( temp, noffset );
+                node_ind_vec.push_back( i );
                 node_id_vec.push_back( m_FeaNodeVec[i]->m_Index );
             }
         }
 
+        if ( node_ind_vec.size() > 0 )
+        {
+            fprintf( temp, "\n" );
+            fprintf( temp, "$ %s Remainingnodes\n", m_StructName.c_str() );
+        }
+        WriteNASTRANNodeCards( temp, node_ind_vec, noffset );
+
         // Write remaining node set
         name = m_StructName + "_Remaining_Gridpoints";
         WriteNASTRANSet( fp, nkey_fp, set_cnt, node_id_vec, name, noffset );
@@ -986,6 +995,7 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
     {
         string name;
         vector < int > shell_elem_id_vec, beam_elem_id_vec;
+        vector < int > elem_ind_vec, elem_prop_vec;
         int elem_id = 0;
 
         // Write FeaParts
@@ -998,9 +1008,12 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
 
                 shell_elem_id_vec.clear();
                 beam_elem_id_vec.clear();
+                elem_ind_vec.clear();
+                elem_prop_vec.clear();
 
                 int property_id = m_FeaPartPropertyIndexVec[i];
                 int cap_property_id = m_FeaPartCapPropertyIndexVec[i];
+                int first_elem_id = elem_id;
 
                 for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                 {
@@ -1008,20 +1021,22 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
                     {
                         if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
                         {
-                            m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, property_id, noffset, eoffset );
+                            elem_prop_vec.push_back( property_id );
                             shell_elem_id_vec.push_back( elem_id );
                             FeaMeshMgr.MarkPropMatUsed( property_id );
                         }
                         else
                         {
-                            m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, cap_property_id, noffset, eoffset );
+                            elem_prop_vec.push_back( cap_property_id );
                             beam_elem_id_vec.push_back( elem_id );
                             FeaMeshMgr.MarkPropMatUsed( cap_property_id );
                         }
+                        elem_ind_vec.push_back( j );
 
                         elem_id++;
                     }
                 }
+                WriteNASTRANElementCards( temp, elem_ind_vec, elem_prop_vec, first_elem_id, noffset, eoffset );
 
                 // Write shell element set
                 name = m_FeaPartNameVec[i] + "_" + m_StructName + "_ShellElements";
@@ -1043,16 +1058,21 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
                 fprintf( temp, "$ %s %s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
 
                 vector < int > mass_elem_id_vec;
+                elem_ind_vec.clear();
+                elem_prop_vec.clear();
+                int first_elem_id = elem_id;
 
                 for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                 {
                     if ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS && m_FeaElementVec[j]->GetFeaPartIndex() == fxpt.m_FeaPartIndex && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
                     {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, -1, noffset, eoffset ); // property ID ignored for Point Masses
+                        elem_ind_vec.push_back( j );
+                        elem_prop_vec.push_back( -1 ); // property ID ignored for Point Masses
                         mass_elem_id_vec.push_back( elem_id );
                         elem_id++;
                     }
                 }
+                WriteNASTRANElementCards( temp, elem_ind_vec, elem_prop_vec, first_elem_id, noffset, eoffset );
 
                 // Write mass element set
                 name = m_FeaPartNameVec[fxpt.m_FeaPartIndex] + "_" +  m_StructName + "_MassElements";
@@ -1071,6 +1091,9 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
 
             shell_elem_id_vec.clear();
             beam_elem_id_vec.clear();
+            elem_ind_vec.clear();
+            elem_prop_vec.clear();
+            int first_elem_id = elem_id;
 
             for ( int j = 0; j < m_FeaElementVec.size(); j++ )
             {
@@ -1078,20 +1101,22 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
                 {
                     if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
                     {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, property_id, noffset, eoffset );
+                        elem_prop_vec.push_back( property_id );
                         shell_elem_id_vec.push_back( elem_id );
                         FeaMeshMgr.MarkPropMatUsed( property_id );
                     }
                     else
                     {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, cap_property_id, noffset, eoffset );
+                        elem_prop_vec.push_back( cap_property_id );
                         beam_elem_id_vec.push_back( elem_id );
                         FeaMeshMgr.MarkPropMatUsed( cap_property_id );
                     }
+                    elem_ind_vec.push_back( j );
 
                     elem_id++;
                 }
             }
+            WriteNASTRANElementCards( temp, elem_ind_vec, elem_prop_vec, first_elem_id, noffset, eoffset );
 
             // Write shell element set
             name = m_SimpleSubSurfaceVec[i].GetName() + "_" + m_StructName + "_ShellElements";
@@ -1104,6 +1129,24 @@ void FeaMesh::WriteNASTRANElements( FILE* fp, FILE* temp, FILE* nkey_fp, int &se
     }
 }
 
+//==== Grid Cards For The Listed Nodes, Formatted In Parallel ====//
+void FeaMesh::WriteNASTRANNodeCards( FILE* fp, const vector < int > & node_ind_vec, int noffset )
+{
+    ParallelUtil::ParallelWrite( fp, ( int )node_ind_vec.size(), [&]( int k, string & buf )
+    {
+        m_FeaNodeVec[ node_ind_vec[k] ]->WriteNASTRAN( buf, noffset );
+    }, FeaMeshMgr.GetNumMeshThreads() );
+}
+
+//==== Element Cards For The Listed Elements, Numbered From first_id ====//
+void FeaMesh::WriteNASTRANElementCards( FILE* fp, const vector < int > & elem_ind_vec, const vector < int > & prop_vec, int first_id, int noffset, int eoffset )
+{
+    ParallelUtil::ParallelWrite( fp, ( int )elem_ind_vec.size(), [&]( int k, string & buf )
+    {
+        m_FeaElementVec[ elem_ind_vec[k] ]->WriteNASTRAN( buf, first_id + k, prop_vec[k], noffset, eoffset );
+    }, FeaMeshMgr.GetNumMeshThreads() );
+}
+
 void CloseNASTRAN( FILE* fp, FILE* temp, FILE* nkey_fp )
 {
     if ( fp && temp )
@@ -1230,15 +1273,14 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
 
     if ( fp )
     {
-        int elem_id = 0;
-        char str[256];
+        vector < int > node_ind_vec;
 
         //==== Write nodes from FeaParts ====//
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
         {
             if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
             {
-                bool NodeHeader = false;
+                node_ind_vec.clear();
 
                 for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
                 {
@@ -1246,17 +1288,18 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
                     {
                         if ( m_FeaNodeVec[ j ]->HasOnlyTag( i ) )
                         {
-                            if ( !NodeHeader )
-                            {
-                                fprintf( fp, "** %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
-                                fprintf( fp, "*NODE, NSET=N%s_%s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
-                                NodeHeader = true;
-                            }
-                            m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
+                            node_ind_vec.push_back( j );
                         }
                     }
                 }
 
+                if ( node_ind_vec.size() > 0 )
+                {
+                    fprintf( fp, "** %s %s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
+                    fprintf( fp, "*NODE, NSET=N%s_%s\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str() );
+                }
+                WriteCalculixNodeCards( fp, node_ind_vec, noffset );
+
                 fprintf( fp, "\n" );
             }
         }
@@ -1296,7 +1339,7 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
         //==== Write SubSurfaces ====//
         for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
         {
-            bool SubSurfHeader = false;
+            node_ind_vec.clear();
 
             for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
             {
@@ -1304,21 +1347,23 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
                 {
                     if ( m_FeaNodeVec[ j ]->HasOnlyTag( i + m_NumFeaParts ) )
                     {
-                        if ( !SubSurfHeader )
-                        {
-                            fprintf( fp, "** %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                            fprintf( fp, "*NODE, NSET=N%s_%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
-                            SubSurfHeader = true;
-                        }
-                        m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
+                        node_ind_vec.push_back( j );
                     }
                 }
             }
+
+            if ( node_ind_vec.size() > 0 )
+            {
+                fprintf( fp, "** %s %s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+                fprintf( fp, "*NODE, NSET=N%s_%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str() );
+            }
+            WriteCalculixNodeCards( fp, node_ind_vec, noffset );
+
             fprintf( fp, "\n" );
         }
 
         //==== Intersection Nodes ====//
-        bool IntersectHeader = false;
+        node_ind_vec.clear();
         for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
         {
             if ( m_PntShift[j] >= 0 )
@@ -1326,39 +1371,33 @@ void FeaMesh::WriteCalculixNodes( FILE* fp )
                 if ( m_FeaNodeVec[j]->m_Tags.size() > 1 &&
                      !m_FeaNodeVec[j]->m_FixedPointFlag )
                 {
-                    if ( !IntersectHeader )
-                    {
-                        fprintf( fp, "** Intersections %s\n", m_StructName.c_str() );
-                        fprintf( fp, "*NODE, NSET=Nintersections_%s\n", m_StructName.c_str() );
-                        IntersectHeader = true;
-                    }
-                    m_FeaNodeVec[j]->WriteCalculix( fp, noffset );
+                    node_ind_vec.push_back( j );
                 }
             }
         }
-        if ( IntersectHeader )
+        if ( node_ind_vec.size() > 0 )
         {
+            fprintf( fp, "** Intersections %s\n", m_StructName.c_str() );
+            fprintf( fp, "*NODE, NSET=Nintersections_%s\n", m_StructName.c_str() );
+            WriteCalculixNodeCards( fp, node_ind_vec, noffset );
             fprintf( fp, "\n" );
         }
 
         //==== Remaining Nodes ====//
-        bool RemainingHeader = false;
+        node_ind_vec.clear();
         for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
         {
             if ( m_PntShift[i] >= 0 &&
                  m_FeaNodeVec[i]->m_Tags.size() == 0 )
             {
-                if ( !RemainingHeader )
-                {
-                    fprintf( fp, "** Remaining Nodes %s\n", m_StructName.c_str() );
-                    fprintf( fp, "*NODE, NSET=RemainingNodes_%s\n", m_StructName.c_str() );
-                    RemainingHeader = true;
-                }
-                m_FeaNodeVec[i]->WriteCalculix( fp, noffset );
+                node_ind_vec.push_back( i );
             }
         }
-        if ( RemainingHeader )
+        if ( node_ind_vec.size() > 0 )
         {
+            fprintf( fp, "** Remaining Nodes %s\n", m_StructName.c_str() );
+            fprintf( fp, "*NODE, NSET=RemainingNodes_%s\n", m_StructName.c_str() );
+            WriteCalculixNodeCards( fp, node_ind_vec, noffset );
             fprintf( fp, "\n" );
         }
     }
@@ -1376,7 +1415,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
     if ( fp )
     {
         int elem_id = 0;
-        char str[256];
+        vector < int > elem_ind_vec;
 
         //==== Write elements from FeaParts ====//
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
@@ -1396,6 +1435,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                         fprintf( fp, "*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_ind_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1403,10 +1443,11 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_ind_vec.push_back( j );
                             }
                         }
+                        WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                        elem_id += elem_ind_vec.size();
                         fprintf( fp, "\n" );
                     }
 
@@ -1417,6 +1458,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                         fprintf( fp, "*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_ind_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1424,10 +1466,11 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_ind_vec.push_back( j );
                             }
                         }
+                        WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                        elem_id += elem_ind_vec.size();
                         fprintf( fp, "\n" );
                     }
 
@@ -1435,6 +1478,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                     {
                         fprintf( fp, "*ELEMENT, TYPE=B32R, ELSET=EB%s_%s_%d_CAP\n", m_FeaPartNameVec[i].c_str(), m_StructName.c_str(), isurf );
 
+                        elem_ind_vec.clear();
                         for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                         {
                             if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
@@ -1442,10 +1486,11 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                                  m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
                                  m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                             {
-                                elem_id++;
-                                m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                                elem_ind_vec.push_back( j );
                             }
                         }
+                        WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                        elem_id += elem_ind_vec.size();
 
                         if ( m_StructSettings.m_BeamPerElementNormal )
                         {
@@ -1453,18 +1498,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                             fprintf( fp, "\n" );
                             fprintf( fp, "*NORMAL\n" );
 
-                            for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                            {
-                                if ( m_FeaElementVec[j]->GetFeaPartIndex() == i &&
-                                     m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
-                                     m_FeaElementVec[j]->GetFeaSSIndex() < 0 &&
-                                     m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
-                                {
-                                    FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                                    assert( beam );
-                                    beam->WriteCalculixNormal( fp, noffset, eoffset );
-                                }
-                            }
+                            WriteCalculixNormalCards( fp, elem_ind_vec, noffset, eoffset );
                         }
 
                         fprintf( fp, "\n" );
@@ -1484,16 +1518,18 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                 fprintf( fp, "** Fixed Point: %s %s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
                 fprintf( fp, "*ELEMENT, TYPE=MASS, ELSET=EP%s_%s\n", m_FeaPartNameVec[fxpt.m_FeaPartIndex].c_str(), m_StructName.c_str() );
 
+                elem_ind_vec.clear();
                 for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                 {
                     if ( m_FeaElementVec[j]->GetFeaPartIndex() == fxpt.m_FeaPartIndex &&
                          m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS &&
                          m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
                     {
-                        elem_id++;
-                        m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                        elem_ind_vec.push_back( j );
                     }
                 }
+                WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                elem_id += elem_ind_vec.size();
 
                 fprintf( fp, "\n" );
 
@@ -1517,16 +1553,18 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                     fprintf( fp, "\n*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_ind_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_3 || m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 ) &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_ind_vec.push_back( j );
                         }
                     }
+                    WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                    elem_id += elem_ind_vec.size();
                     fprintf( fp, "\n" );
                 }
 
@@ -1537,16 +1575,18 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
 
                     fprintf( fp, "\n*ELEMENT, TYPE=S%d, ELSET=E%s_%s_%d\n", nnode, m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_ind_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_QUAD_4 || m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_QUAD_8 ) &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_ind_vec.push_back( j );
                         }
                     }
+                    WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                    elem_id += elem_ind_vec.size();
                     fprintf( fp, "\n" );
                 }
 
@@ -1555,16 +1595,18 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                     fprintf( fp, "\n" );
                     fprintf( fp, "*ELEMENT, TYPE=B32R, ELSET=EB%s_%s_%d_CAP\n", m_SimpleSubSurfaceVec[i].GetName().c_str(), m_StructName.c_str(), isurf );
 
+                    elem_ind_vec.clear();
                     for ( int j = 0; j < m_FeaElementVec.size(); j++ )
                     {
                         if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
                              m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
                              m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
                         {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id, noffset, eoffset );
+                            elem_ind_vec.push_back( j );
                         }
                     }
+                    WriteCalculixElementCards( fp, elem_ind_vec, elem_id + 1, noffset, eoffset );
+                    elem_id += elem_ind_vec.size();
 
 
                     if ( m_StructSettings.m_BeamPerElementNormal )
@@ -1573,17 +1615,7 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
                         fprintf( fp, "\n" );
                         fprintf( fp, "*NORMAL\n" );
 
-                        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                        {
-                            if ( m_FeaElementVec[j]->GetFeaSSIndex() == i &&
-                                 m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM &&
-                                 m_FeaElementVec[j]->GetFeaPartSurfNum() == isurf )
-                            {
-                                FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                                assert( beam );
-                                beam->WriteCalculixNormal( fp, noffset, eoffset );
-                            }
-                        }
+                        WriteCalculixNormalCards( fp, elem_ind_vec, noffset, eoffset );
                     }
 
                     fprintf( fp, "\n" );
@@ -1593,6 +1625,35 @@ void FeaMesh::WriteCalculixElements( FILE* fp )
     }
 }
 
+//==== Node Cards For The Listed Nodes, Formatted In Parallel ====//
+void FeaMesh::WriteCalculixNodeCards( FILE* fp, const vector < int > & node_ind_vec, int noffset )
+{
+    ParallelUtil::ParallelWrite( fp, ( int )node_ind_vec.size(), [&]( int k, string & buf )
+    {
+        m_FeaNodeVec[ node_ind_vec[k] ]->WriteCalculix( buf, noffset );
+    }, FeaMeshMgr.GetNumMeshThreads() );
+}
+
+//==== Element Cards For The Listed Elements, Numbered From first_id ====//
+void FeaMesh::WriteCalculixElementCards( FILE* fp, const vector < int > & elem_ind_vec, int first_id, int noffset, int eoffset )
+{
+    ParallelUtil::ParallelWrite( fp, ( int )elem_ind_vec.size(), [&]( int k, string & buf )
+    {
+        m_FeaElementVec[ elem_ind_vec[k] ]->WriteCalculix( buf, first_id + k, noffset, eoffset );
+    }, FeaMeshMgr.GetNumMeshThreads() );
+}
+
+//==== Normals Of The Listed Beams, Written After Their Element Cards ====//
+void FeaMesh::WriteCalculixNormalCards( FILE* fp, const vector < int > & elem_ind_vec, int noffset, int eoffset )
+{
+    ParallelUtil::ParallelWrite( fp, ( int )elem_ind_vec.size(), [&]( int k, string & buf )
+    {
+        FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[ elem_ind_vec[k] ] );
+        assert( beam );
+        beam->WriteCalculixNormal( buf, noffset, eoffset );
+    }, FeaMeshMgr.GetNumMeshThreads() );
+}
+
 void FeaMesh::WriteCalculixBCs( FILE* fp )
 {
     int noffset = m_StructSettings.m_NodeOffset;
@@ -99,6 +99,14 @@ public:
     // Was protected.
     virtual void WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, int & set_num, vector < int > set_ids, const string &set_name, const int &offset );
 
+    // Card writers for lists of node/element indices.  Cards are formatted in
+    // parallel and written in list order, element ids run from first_id.
+    void WriteNASTRANNodeCards( FILE* fp, const vector < int > & node_ind_vec, int noffset );
+    void WriteNASTRANElementCards( FILE* fp, const vector < int > & elem_ind_vec, const vector < int > & prop_vec, int first_id, int noffset, int eoffset );
+    void WriteCalculixNodeCards( FILE* fp, const vector < int > & node_ind_vec, int noffset );
+    void WriteCalculixElementCards( FILE* fp, const vector < int > & elem_ind_vec, int first_id, int noffset, int eoffset );
+    void WriteCalculixNormalCards( FILE* fp, const vector < int > & elem_ind_vec, int noffset, int eoffset );
+
     virtual void ComputeWriteMass();
 
     virtual FixPoint* GetFixPointByID( const string &id );
@@ -333,7 +333,7 @@ void FeaMeshMgrSingleton::TransferBCData()
 
         for ( int i = 0; i < nbc; i++ )
         {
-            GetMeshPtr()->m_BCVec[i].CopyFrom( bc_vec[i] );
+            GetMeshPtr()->m_BCVec[i].CopyFrom( bc_vec[i], GetMeshPtr()->m_FeaPartIDVec, GetSimpSubSurfIndex( bc_vec[i]->GetSubSurfID() ) );
         }
     }
 }
@@ -346,6 +346,40 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     addOutputText( _("Init Timer\n") );
 #endif
 
+    if ( !SetupFeaMesh() )
+    {
+        return;
+    }
+
+    IntersectFeaSurfaces();
+
+    if ( m_CADOnlyFlag )
+    {
+        UpdateDrawObjs();
+
+        addOutputText( _("Finished\n") );
+
+        m_FeaMeshInProgress = false;
+        m_CADOnlyFlag = false;
+        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+        return;
+    }
+
+    MeshFeaSurfaces();
+
+    FinishFeaMesh();
+
+    addOutputText( _("Finished\n") );
+
+    m_FeaMeshInProgress = false;
+    MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+}
+
+// Load the structure's surfaces, parts and settings.  Reads the Vehicle and
+// StructureMgr, so it must run on the main thread.  Returns false if there is
+// nothing to mesh.
+bool FeaMeshMgrSingleton::SetupFeaMesh()
+{
     addOutputText( _("Transfer Mesh Settings\n") );
     TransferMeshSettings();
 
@@ -357,7 +391,7 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
         addOutputText( _("No Surfaces.  Done.\n") );
         m_FeaMeshInProgress = false;
         MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
-        return;
+        return false;
     }
 
     if ( !m_CADOnlyFlag )
@@ -401,6 +435,12 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     addOutputText( _("Identify CompID Names\n") );
     IdentifyCompIDNames();
 
+    return true;
+}
+
+// Intersect the loaded surfaces.  Only touches this manager's data.
+void FeaMeshMgrSingleton::IntersectFeaSurfaces()
+{
     // TODO: Update and Build Domain for Half Mesh?
 
     addOutputText( _("Build Slice Planes\n") );
@@ -413,28 +453,18 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     BinaryAdaptIntCurves();
 
     m_IntersectComplete = true;
+}
 
-    if ( m_CADOnlyFlag )
-    {
-        UpdateDrawObjs();
-
-        addOutputText( _("Finished\n") );
-
-        m_FeaMeshInProgress = false;
-        m_CADOnlyFlag = false;
-        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
-        return;
-    }
-
+// Mesh the intersected surfaces.  Only touches this manager's data, so
+// independent structures can be meshed at the same time.
+void FeaMeshMgrSingleton::MeshFeaSurfaces()
+{
     addOutputText( _("Build Target Map\n") );
     BuildTargetMap( CfdMeshMgrSingleton::VOCAL_OUTPUT );
 
     // addOutputText( _("InitMesh\n") ); // Output inside InitMesh
     InitMesh();
 
-    addOutputText( _("Sub Tag Tris\n") );
-    SubTagTris();
-
     addOutputText( _("Set Fixed Points\n") );
     SetFixPointSurfaceNodes();
 
@@ -450,6 +480,14 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     addOutputText( _("ConnectBorderEdges\n") );
     ConnectBorderEdges( false );        // No Wakes
     ConnectBorderEdges( true );         // Only Wakes
+}
+
+// Tag the surface mesh and build the FeaMesh.  Tagging goes through the
+// global SubSurfaceMgr, so structures are finished one at a time.
+void FeaMeshMgrSingleton::FinishFeaMesh()
+{
+    addOutputText( _("Sub Tag Tris\n") );
+    SubTagTris();
 
     addOutputText( _("Post Mesh\n") );
     PostMesh();
@@ -475,11 +513,6 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
     GetMeshPtr()->m_MeshReady = true;
 
     UpdateDrawObjs();
-
-    addOutputText( _("Finished\n") );
-
-    m_FeaMeshInProgress = false;
-    MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
 }
 
 void FeaMeshMgrSingleton::ExportFeaMesh( string structID )
@@ -2390,7 +2423,7 @@ void FeaMeshMgrSingleton::TagFeaNodes()
         {
             if ( GetMeshPtr()->m_PntShift[j] >= 0 )
             {
-                GetMeshPtr()->m_BCVec[i].ApplyTo( GetMeshPtr()->m_FeaNodeVec[j] );
+                GetMeshPtr()->m_BCVec[i].ApplyTo( GetMeshPtr()->m_FeaNodeVec[j], GetMeshPtr()->m_NumFeaParts );
             }
         }
     }
@@ -2543,6 +2576,26 @@ Surf* FeaMeshMgrSingleton::GetFeaSurf( int FeaPartID, int surf_num )
 
 void FeaMeshMgrSingleton::MeshUnMeshed( const vector < string > & idvec )
 {
+    vector < string > unmeshed_vec;
+    for ( int i = 0; i < idvec.size(); i++ )
+    {
+        FeaMesh* mesh = GetMeshPtr( idvec[i] );
+        if ( !mesh || !mesh->m_MeshReady )
+        {
+            unmeshed_vec.push_back( idvec[i] );
+        }
+    }
+
+    // Wakes live in the global WakeMgr, so a mesh with wakes must stay serial.
+    if ( unmeshed_vec.size() > 1 && GetNumMeshThreads() != 1 && WakeMgr.GetNumLeadingEdges() == 0 )
+    {
+        MeshStructures( unmeshed_vec );
+
+        // Leave the active structure where the serial loop below would.
+        SetFeaMeshStructID( idvec.back() );
+        return;
+    }
+
     for ( int i = 0; i < idvec.size(); i++ )
     {
         SetFeaMeshStructID( idvec[i] );
@@ -2560,6 +2613,85 @@ void FeaMeshMgrSingleton::MeshUnMeshed( const vector < string > & idvec )
     }
 }
 
+// Mesh independent structures at the same time.  Each structure but the last
+// is meshed by a private manager that borrows its FeaMesh from m_MeshPtrMap,
+// the last is meshed by this manager so it is left as after GenerateFeaMesh.
+// Setup and finishing touch global state and run here in order, only the
+// intersection and surface meshing run in parallel.
+void FeaMeshMgrSingleton::MeshStructures( const vector < string > & idvec )
+{
+    int njob = idvec.size();
+
+    m_FeaMeshInProgress = true;
+
+    //==== Meshes Are Created Up Front, Workers Never Change The Map ====//
+    vector < FeaMeshMgrSingleton* > mgr_vec( njob );
+    for ( int j = 0; j < njob - 1; j++ )
+    {
+        string struct_id = idvec[j];
+
+        if ( !GetMeshPtr( struct_id ) )
+        {
+            m_MeshPtrMap[ struct_id ] = new FeaMesh( struct_id );
+        }
+
+        mgr_vec[j] = new FeaMeshMgrSingleton();
+        mgr_vec[j]->m_MeshPtrMap[ struct_id ] = m_MeshPtrMap[ struct_id ];
+    }
+    mgr_vec[ njob - 1 ] = this;
+
+    //==== Split The Threads Between Structures ====//
+    int old_num_threads = m_NumMeshThreads;
+    int job_threads = max( 1, ParallelUtil::GetNumThreads() / njob );
+
+    vector < bool > ready_vec( njob, false );
+    for ( int j = 0; j < njob; j++ )
+    {
+        FeaMeshMgrSingleton* mgr = mgr_vec[j];
+
+        mgr->SetFeaMeshStructID( idvec[j] );
+        mgr->SetNumMeshThreads( job_threads );
+        mgr->m_FeaMeshInProgress = true;
+
+        ready_vec[j] = mgr->SetupFeaMesh();
+    }
+
+    ParallelUtil::ParallelFor( njob, [&]( int j )
+    {
+        if ( ready_vec[j] )
+        {
+            mgr_vec[j]->IntersectFeaSurfaces();
+            mgr_vec[j]->MeshFeaSurfaces();
+        }
+    } );
+
+    for ( int j = 0; j < njob; j++ )
+    {
+        FeaMeshMgrSingleton* mgr = mgr_vec[j];
+
+        if ( ready_vec[j] )
+        {
+            mgr->FinishFeaMesh();
+            mgr->addOutputText( _("Finished\n") );
+        }
+
+        mgr->m_FeaMeshInProgress = false;
+
+        // Trigger screen update after each mesh generation.
+        MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
+    }
+
+    //==== Hand The Meshes Back Before Deleting The Workers ====//
+    for ( int j = 0; j < njob - 1; j++ )
+    {
+        mgr_vec[j]->m_MeshPtrMap.clear();
+        mgr_vec[j]->m_ActiveMesh = NULL;
+        delete mgr_vec[j];
+    }
+
+    SetNumMeshThreads( old_num_threads );
+}
+
 void FeaMeshMgrSingleton::CleanupMeshes( const vector < string > & idvec )
 {
     for ( int i = 0; i < idvec.size(); i++ )
@@ -96,6 +96,10 @@ public:
     virtual bool LoadSurfaces();
     virtual void LoadSkins();
     virtual void GenerateFeaMesh();
+    virtual bool SetupFeaMesh();
+    virtual void IntersectFeaSurfaces();
+    virtual void MeshFeaSurfaces();
+    virtual void FinishFeaMesh();
     virtual void ExportFeaMesh( string structID );
     virtual void ExportCADFiles();
     virtual void TransferMeshSettings();
@@ -214,6 +218,7 @@ public:
     virtual Surf* GetFeaSurf( int FeaPartID, int surf_num );
 
     virtual void MeshUnMeshed( const vector < string > & idvec );
+    virtual void MeshStructures( const vector < string > & idvec );
     virtual void CleanupMeshes( const vector < string > & idvec );
     virtual void ExportAssemblyMesh( const string &assembly_id );
 
@@ -357,7 +357,7 @@ void ISeg::JoinFront( ISeg* seg )
     }
 }
 
-ISeg* ISeg::Split( Surf* sPtr, vec2d & uw, SurfaceIntersectionSingleton *MeshMgr )
+ISeg* ISeg::Split( Surf* sPtr, vec2d & uw, IPntPool *pool )
 {
     vec2d uwa, uwb;
     if ( sPtr == m_SurfA )
@@ -390,11 +390,11 @@ ISeg* ISeg::Split( Surf* sPtr, vec2d & uw, SurfaceIntersectionSingleton *MeshMgr
     if ( m_SurfA->ValidUW( uwa ) && m_SurfB->ValidUW( uwb ) )
     {
         Puw* pwa = new Puw( m_SurfA, uwa );
-        MeshMgr->AddDelPuw( pwa );
+        pool->AddDelPuw( pwa );
         Puw* pwb = new Puw( m_SurfB, uwb );
-        MeshMgr->AddDelPuw( pwb );
+        pool->AddDelPuw( pwb );
         IPnt* ip = new IPnt( pwa, pwb );
-        MeshMgr->AddDelIPnt( ip );
+        pool->AddDelIPnt( ip );
         ip->CompPnt();
         ISeg* sseg = new ISeg( m_SurfA, m_SurfB, ip, m_IPnt[1] );
         m_IPnt[1] = ip;
@@ -463,7 +463,7 @@ void ISegBox::BuildSubDivide()
 
 }
 
-void ISegBox::Intersect( ISegBox* box )
+void ISegBox::Intersect( ISegBox* box, vector< ISegCross > & cross_vec )
 {
     int i, j;
     if ( !Compare( m_Box, box->m_Box ) )
@@ -473,13 +473,13 @@ void ISegBox::Intersect( ISegBox* box )
 
     if ( m_SubBox[0] && m_SubBox[1] )
     {
-        m_SubBox[0]->Intersect( box );
-        m_SubBox[1]->Intersect( box );
+        m_SubBox[0]->Intersect( box, cross_vec );
+        m_SubBox[1]->Intersect( box, cross_vec );
     }
     else if ( box->m_SubBox[0] && box->m_SubBox[1] )
     {
-        Intersect( box->m_SubBox[0] );
-        Intersect( box->m_SubBox[1] );
+        Intersect( box->m_SubBox[0], cross_vec );
+        Intersect( box->m_SubBox[1], cross_vec );
     }
     else
     {
@@ -495,8 +495,15 @@ void ISegBox::Intersect( ISegBox* box )
                 vec2d p3 = box->m_ChainPtr->m_ISegDeque[j]->m_IPnt[1]->GetPuw( m_Surf )->m_UW;
                 if ( seg_seg_intersect( p0, p1, p2, p3, int_pnt ) )
                 {
-                    m_ChainPtr->AddSplit( m_Surf, i, int_pnt );
-                    box->m_ChainPtr->AddSplit( box->m_Surf, j, int_pnt );
+                    ISegCross cross;
+                    cross.m_ChainA = m_ChainPtr;
+                    cross.m_SurfA = m_Surf;
+                    cross.m_IndexA = i;
+                    cross.m_ChainB = box->m_ChainPtr;
+                    cross.m_SurfB = box->m_Surf;
+                    cross.m_IndexB = j;
+                    cross.m_UW = int_pnt;
+                    cross_vec.push_back( cross );
                 }
             }
         }
@@ -856,6 +863,19 @@ void ISegChain::BuildBoxes()
 }
 
 void ISegChain::Intersect( Surf* surfPtr, ISegChain* B )
+{
+    vector< ISegCross > cross_vec;
+    FindCrossings( surfPtr, B, cross_vec );
+
+    for ( int i = 0 ; i < ( int )cross_vec.size() ; i++ )
+    {
+        AddSplit( cross_vec[i].m_SurfA, cross_vec[i].m_IndexA, cross_vec[i].m_UW );
+        B->AddSplit( cross_vec[i].m_SurfB, cross_vec[i].m_IndexB, cross_vec[i].m_UW );
+    }
+}
+
+//==== Find Crossings Without Touching Either Chain's Splits ====//
+void ISegChain::FindCrossings( Surf* surfPtr, ISegChain* B, vector< ISegCross > & cross_vec )
 {
     ISegBox* box1;
     if ( surfPtr == m_SurfA )
@@ -877,7 +897,7 @@ void ISegChain::Intersect( Surf* surfPtr, ISegChain* B )
         box2 = &B->m_ISegBoxB;
     }
 
-    box1->Intersect( box2 );
+    box1->Intersect( box2, cross_vec );
 
 }
 
@@ -1147,7 +1167,7 @@ bool SplitCompare( const ISegSplit* a, const ISegSplit* b )
 }
 
 
-vector< ISegChain* > ISegChain::SortAndSplit( SurfaceIntersectionSingleton *MeshMgr )
+vector< ISegChain* > ISegChain::SortAndSplit( IPntPool *pool )
 {
 //for ( int i = 0 ; i < (int)m_SplitVec.size() ; i++ )
 //  printf(_("Split Index = %d %f\n"), m_SplitVec[i]->m_Index,  m_SplitVec[i]->m_Fract );
@@ -1162,7 +1182,7 @@ vector< ISegChain* > ISegChain::SortAndSplit( SurfaceIntersectionSingleton *Mesh
     for ( int i = 0 ; i < ( int )m_SplitVec.size() ; i++ )
     {
         ISegSplit* s = m_SplitVec[i];
-        ISeg* new_seg = m_ISegDeque[s->m_Index]->Split( s->m_Surf, s->m_UW, MeshMgr );
+        ISeg* new_seg = m_ISegDeque[s->m_Index]->Split( s->m_Surf, s->m_UW, pool );
 
         if ( new_seg )
         {
@@ -1298,7 +1318,7 @@ void ISegChain::TransferTess( )
     m_BCurve.Tesselate( autess );
 }
 
-void ISegChain::ApplyTess( SurfaceIntersectionSingleton *MeshMgr )
+void ISegChain::ApplyTess( IPntPool *pool )
 {
     //==== Clear Old Tess ====//
     m_TessVec.clear();
@@ -1307,13 +1327,19 @@ void ISegChain::ApplyTess( SurfaceIntersectionSingleton *MeshMgr )
     vector< vec3d > tuwb = m_BCurve.GetUWTessPnts();
     assert( tuwa.size() == tuwb.size() );
 
+    //==== Evaluate Each Surface In One Batch ====//
+    vector< vec3d > pnta;
+    vector< vec3d > pntb;
+    m_SurfA->CompPnts( tuwa, pnta );
+    m_SurfB->CompPnts( tuwb, pntb );
+
     //==== Add Other IPnts ====//
     for ( int i = 0 ; i < ( int )tuwa.size() ; i++ )
     {
         Puw* puwa = new Puw( m_SurfA, vec2d( tuwa[i][0], tuwa[i][1] ) );
-        MeshMgr->AddDelPuw( puwa );
+        pool->AddDelPuw( puwa );
         Puw* puwb = new Puw( m_SurfB, vec2d( tuwb[i][0], tuwb[i][1] ) );
-        MeshMgr->AddDelPuw( puwb );
+        pool->AddDelPuw( puwb );
 
         IPnt* ip  = new IPnt( puwa, puwb );
 
@@ -1327,7 +1353,8 @@ void ISegChain::ApplyTess( SurfaceIntersectionSingleton *MeshMgr )
         //double d = dist( pA, pB );
         //  printf( _("%d Big D = %f \n"),i, d );
 
-        ip->CompPnt();
+        // Same as ip->CompPnt()
+        ip->m_Pnt = ( pnta[i] + pntb[i] ) * 0.5;
         m_TessVec.push_back( ip );
     }
 
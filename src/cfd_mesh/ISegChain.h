@@ -86,6 +86,26 @@ public:
     deque< ISeg* > m_Segs;
 };
 
+//==== Puws and IPnts Created While Working On One Chain ====//
+// Kept apart so chains can be worked on in parallel, then handed to the
+// mesh manager in chain order for deletion.
+class IPntPool
+{
+public:
+
+    void AddDelPuw( Puw* puw )
+    {
+        m_DelPuwVec.push_back( puw );
+    }
+    void AddDelIPnt( IPnt* ip )
+    {
+        m_DelIPntVec.push_back( ip );
+    }
+
+    vector< Puw* > m_DelPuwVec;
+    vector< IPnt* > m_DelIPntVec;
+};
+
 //==== Intersection Segment ====//
 class ISeg
 {
@@ -105,7 +125,7 @@ public:
     double MinDist( IPnt* ip  );
     void JoinBack( ISeg* seg );
     void JoinFront( ISeg* seg );
-    ISeg* Split( Surf* sPtr, vec2d & uw, SurfaceIntersectionSingleton *MeshMgr );
+    ISeg* Split( Surf* sPtr, vec2d & uw, IPntPool *pool );
 
     bool Match( ISeg* seg );
 
@@ -125,6 +145,22 @@ public:
     vec3d m_Pnt;
 };
 
+//==== Crossing Between Segments Of Two Chains ====//
+class ISegCross
+{
+public:
+
+    ISegChain* m_ChainA;
+    Surf* m_SurfA;
+    int m_IndexA;
+
+    ISegChain* m_ChainB;
+    Surf* m_SurfB;
+    int m_IndexB;
+
+    vec2d m_UW;
+};
+
 //==== Bound Box Surrounding ISeg Chains ====//
 class ISegBox
 {
@@ -152,7 +188,7 @@ public:
 
     void BuildSubDivide();
 
-    void Intersect( ISegBox* box );
+    void Intersect( ISegBox* box, vector< ISegCross > & cross_vec );
 
     // void Draw();
 
@@ -180,19 +216,20 @@ public:
     bool Match( ISegChain* B );
 
     void Intersect( Surf* surfPtr, ISegChain* B );
+    void FindCrossings( Surf* surfPtr, ISegChain* B, vector< ISegCross > & cross_vec );
 
     void AddSplit( Surf* surfPtr, int index, vec2d int_pnt );
     bool AddBorderSplit( Puw* uw ); // Return true if split successfully added
 
     void MergeSplits();
     void RemoveChainEndSplits();
-    vector< ISegChain* > SortAndSplit( SurfaceIntersectionSingleton *MeshMgr );
+    vector< ISegChain* > SortAndSplit( IPntPool *pool );
     vector< ISegChain* > FindCoPlanarChains( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
     void MergeInteriorIPnts();
 
     void BuildCurves();
     void TransferTess();
-    void ApplyTess( SurfaceIntersectionSingleton *MeshMgr );
+    void ApplyTess( IPntPool *pool );
 
     void SpreadDensity( );
     void CalcDensity( SimpleGridDensity* grid_den, list< MapSource* > & splitSources );
@@ -12,9 +12,11 @@
 #include "CfdMeshMgr.h"
 #include "tri_tri_intersect.h"
 
+#include <algorithm>
+
 #include "eli/geom/intersect/intersect_surface.hpp"
 
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr )
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs )
 {
     int MAX_SUB = 12;
     int MIN_SUB = 3;
@@ -43,7 +45,7 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
     if ( ( planar1 || bp1.GetSubDepth() > MAX_SUB ) &&
          ( planar2 || bp2.GetSubDepth() > MAX_SUB ) )
     {
-        intersect_quads( bp1, bp2, MeshMgr );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, isegs );          // Plane - Plane Intersection
     }
     else
     {
@@ -71,10 +73,10 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp1.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch1 and Keep Subdividing
 
-            intersect( bps0, bp2, MeshMgr );
-            intersect( bps1, bp2, MeshMgr );
-            intersect( bps2, bp2, MeshMgr );
-            intersect( bps3, bp2, MeshMgr );
+            intersect( bps0, bp2, isegs );
+            intersect( bps1, bp2, isegs );
+            intersect( bps2, bp2, isegs );
+            intersect( bps3, bp2, isegs );
         }
         else
         {
@@ -89,15 +91,15 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp2.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch2 and Keep Subdividing
 
-            intersect( bp1, bps0, MeshMgr );
-            intersect( bp1, bps1, MeshMgr );
-            intersect( bp1, bps2, MeshMgr );
-            intersect( bp1, bps3, MeshMgr );
+            intersect( bp1, bps0, isegs );
+            intersect( bp1, bps1, isegs );
+            intersect( bp1, bps2, isegs );
+            intersect( bp1, bps3, isegs );
         }
     }
 }
 
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr )
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & isegs )
 {
     int iflag;
     int coplanar = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
@@ -138,7 +140,7 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A1 and B2 ====//
@@ -146,7 +148,7 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A2 and B1 ====//
@@ -154,7 +156,7 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A2 and B2 ====//
@@ -162,7 +164,185 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersection_test_3d( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_intersect_seg( pa, pb, ip0, ip1, isegs );
+    }
+}
+
+void add_intersect_seg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, vector< PatchISeg > & isegs )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return;
+    }
+
+    vec2d plane_uwA0;
+    pA.find_closest_uw_planar_approx( ip0, plane_uwA0.v );
+
+    vec2d plane_uwB0;
+    pB.find_closest_uw_planar_approx( ip0, plane_uwB0.v );
+
+    vec2d plane_uwA1;
+    pA.find_closest_uw_planar_approx( ip1, plane_uwA1.v );
+
+    vec2d plane_uwB1;
+    pB.find_closest_uw_planar_approx( ip1, plane_uwB1.v );
+
+    // Intersections that lie exactly on a patch boundary will actually intersect both patches
+    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
+    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
+    // there is no prior patch.
+
+    double tol = 1e-10; // Tolerance buildup due to SurfPatch::find_closest_uw_planar_approx and other inaccuracies
+
+    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
+    {
+        double lim = pA.get_u_min() + tol;
+        // if both points projected to A are on the starting edge of u
+        if ( plane_uwA0.v[0] <= lim && plane_uwA1.v[0] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
+    {
+        double lim = pB.get_u_min() + tol;
+        // if both points projected to B are on the starting edge of u
+        if ( plane_uwB0.v[0] <= lim && plane_uwB1.v[0] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
+    {
+        double lim = pA.get_w_min() + tol;
+        // if both points projected to A are on the starting edge of w
+        if ( plane_uwA0.v[1] <= lim && plane_uwA1.v[1] <= lim )
+        {
+            return;
+        }
+    }
+
+    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
+    {
+        double lim = pB.get_w_min() + tol;
+        // if both points projected to B are on the starting edge of w
+        if ( plane_uwB0.v[1] <= lim && plane_uwB1.v[1] <= lim )
+        {
+            return;
+        }
+    }
+
+    PatchISeg iseg;
+    iseg.m_SurfA = pA.get_surf_ptr();
+    iseg.m_SurfB = pB.get_surf_ptr();
+    iseg.m_Pnt[0] = ip0;
+    iseg.m_Pnt[1] = ip1;
+
+    pA.find_closest_uw( ip0, plane_uwA0.v, iseg.m_UWA[0].v );
+    pB.find_closest_uw( ip0, plane_uwB0.v, iseg.m_UWB[0].v );
+    pA.find_closest_uw( ip1, plane_uwA1.v, iseg.m_UWA[1].v );
+    pB.find_closest_uw( ip1, plane_uwB1.v, iseg.m_UWB[1].v );
+
+    // Identify rectangles to represent final patches
+    iseg.m_PatchADrawLines = pA.GetPatchDrawLines();
+    iseg.m_PatchBDrawLines = pB.GetPatchDrawLines();
+
+    isegs.push_back( iseg );
+}
+
+////////////////////////////////////////////////////////////////////////
+////==== Bound Box Tree Over Patches ====//
+////////////////////////////////////////////////////////////////////////
+SurfPatchBox::~SurfPatchBox()
+{
+    delete m_SubBox[0];
+    delete m_SubBox[1];
+}
+
+void SurfPatchBox::BuildSubDivide()
+{
+    const vector< SurfPatch* > & patches = *m_PatchVec;
+    vector< int > & inds = *m_PatchInd;
+
+    m_Box.Reset();
+    for ( int i = m_BeginInd ; i < m_EndInd ; i++ )
+    {
+        m_Box.Update( *patches[ inds[i] ]->get_bbox() );
+    }
+
+    if ( m_EndInd - m_BeginInd <= 4 )
+    {
+        return;
+    }
+
+    //==== Split At Median Patch Center Along Longest Side ====//
+    vec3d span = m_Box.GetMax() - m_Box.GetMin();
+    int axis = 0;
+    if ( span[1] > span[axis] )
+    {
+        axis = 1;
+    }
+    if ( span[2] > span[axis] )
+    {
+        axis = 2;
+    }
+
+    int split = ( m_EndInd + m_BeginInd ) / 2;
+
+    nth_element( inds.begin() + m_BeginInd, inds.begin() + split, inds.begin() + m_EndInd,
+                 [&]( int a, int b )
+                 {
+                     double ca = patches[a]->get_bbox()->GetCenter()[axis];
+                     double cb = patches[b]->get_bbox()->GetCenter()[axis];
+                     if ( ca != cb )
+                     {
+                         return ca < cb;
+                     }
+                     return a < b;
+                 } );
+
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        m_SubBox[i] = new SurfPatchBox;
+        m_SubBox[i]->m_PatchInd = m_PatchInd;
+        m_SubBox[i]->m_PatchVec = m_PatchVec;
+    }
+
+    m_SubBox[0]->m_BeginInd = m_BeginInd;
+    m_SubBox[0]->m_EndInd   = split;
+
+    m_SubBox[1]->m_BeginInd = split;
+    m_SubBox[1]->m_EndInd = m_EndInd;
+
+    m_SubBox[0]->BuildSubDivide();
+    m_SubBox[1]->BuildSubDivide();
+}
+
+void SurfPatchBox::FindOverlap( const BndBox & box, vector< int > & patch_inds ) const
+{
+    if ( !Compare( m_Box, box ) )
+    {
+        return;
+    }
+
+    if ( m_SubBox[0] && m_SubBox[1] )
+    {
+        m_SubBox[0]->FindOverlap( box, patch_inds );
+        m_SubBox[1]->FindOverlap( box, patch_inds );
+    }
+    else
+    {
+        for ( int i = m_BeginInd ; i < m_EndInd ; i++ )
+        {
+            int ind = ( *m_PatchInd )[i];
+            if ( Compare( *( *m_PatchVec )[ind]->get_bbox(), box ) )
+            {
+                patch_inds.push_back( ind );
+            }
+        }
     }
 }
 
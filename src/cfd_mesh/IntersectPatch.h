@@ -27,9 +27,58 @@ using namespace std;
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
 
+//==== Intersection Segment Between Two Patches, Projected To Both Surfaces ====//
+class PatchISeg
+{
+public:
+
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+
+    vec3d m_Pnt[2];
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+
+    vector < vec3d > m_PatchADrawLines;
+    vector < vec3d > m_PatchBDrawLines;
+};
+
+//==== Bounding Box Tree Over Patches From Many Surfaces ====//
+class SurfPatchBox
+{
+public:
+
+    SurfPatchBox()
+    {
+        m_BeginInd = 0;
+        m_EndInd = 0;
+        m_SubBox[0] = m_SubBox[1] = NULL;
+        m_PatchInd = NULL;
+        m_PatchVec = NULL;
+    }
+    virtual ~SurfPatchBox();
+
+    int m_BeginInd;
+    int m_EndInd;
+
+    // m_PatchInd is reordered so each box holds m_PatchInd[m_BeginInd] .. m_PatchInd[m_EndInd - 1]
+    vector< int >* m_PatchInd;
+    const vector< SurfPatch* >* m_PatchVec;
+
+    BndBox m_Box;
+
+    SurfPatchBox* m_SubBox[2];
+
+    void BuildSubDivide();
+
+    // Append indices of all patches whose box overlaps box
+    void FindOverlap( const BndBox & box, vector< int > & patch_inds ) const;
+};
+
 //===== Intersect Two Bezier Patches  =====//
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr );
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchISeg > & isegs );
+void add_intersect_seg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, vector< PatchISeg > & isegs );
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] );
 double refine_intersect_pt( const vec3d& pt, Surf *sA, vec2d &uwA, Surf *sB, vec2d &uwB );
 
@@ -11,6 +11,7 @@
 #include "Mesh.h"
 #include "Surf.h"
 #include "VspUtil.h"
+#include "ParallelUtil.h"
 #include <triangle.h>
 #include <triangle_api.h>
 #include "SurfaceIntersectionMgr.h"
@@ -52,7 +53,7 @@ void Mesh::Clear()
     list< Face* >::iterator f;
     for ( f = faceList.begin() ; f != faceList.end(); ++f )
     {
-        delete ( *f );
+        m_FacePool.Delete( *f );
     }
 
     faceList.clear();
@@ -60,7 +61,7 @@ void Mesh::Clear()
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
     {
-        delete ( *e );
+        m_EdgePool.Delete( *e );
     }
 
     edgeList.clear();
@@ -68,7 +69,7 @@ void Mesh::Clear()
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
     {
-        delete ( *n );
+        m_NodePool.Delete( *n );
     }
 
     nodeList.clear();
@@ -547,7 +548,7 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = m_NodePool.New( p, uw_in );
     nodeList.push_back( nptr );
     nptr->list_ptr = --nodeList.end();
     return nptr;
@@ -576,7 +577,7 @@ Node* Mesh::FindNode( const vec3d& p )
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = m_EdgePool.New( n0, n1 );
 
     edgeList.push_back( eptr );
     eptr->list_ptr = --edgeList.end();
@@ -602,27 +603,13 @@ void Mesh::RemoveEdge( Edge* eptr )
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
-    {
-        if ( !( *e )->m_DeleteMeFlag )
-        {
-            if ( ( *e )->n0 == n0 && ( *e )->n1 == n1 )
-            {
-                return ( *e );
-            }
-            if ( ( *e )->n0 == n1 && ( *e )->n1 == n0 )
-            {
-                return ( *e );
-            }
-        }
-    }
-    return NULL;
+    // Removed edges are already gone from the node edge lists
+    return n0->FindEdge( n1 );
 }
 
 Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 )
 {
-    Face* fptr = new Face( nn0, nn1, nn2, ee0, ee1, ee2 );
+    Face* fptr = m_FacePool.New( nn0, nn1, nn2, ee0, ee1, ee2 );
     faceList.push_back( fptr );
     fptr->list_ptr = --faceList.end();
 
@@ -635,7 +622,7 @@ Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge
 
 Face* Mesh::AddFace( Node* nn0, Node* nn1, Node* nn2, Node* nn3, Edge* ee0, Edge* ee1, Edge* ee2, Edge* ee3 )
 {
-    Face* fptr = new Face( nn0, nn1, nn2, nn3, ee0, ee1, ee2, ee3 );
+    Face* fptr = m_FacePool.New( nn0, nn1, nn2, nn3, ee0, ee1, ee2, ee3 );
     faceList.push_back( fptr );
     fptr->list_ptr = --faceList.end();
 
@@ -659,21 +646,21 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Delete( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Delete( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Faces =====//
     for ( int i = 0 ; i < ( int )garbageFaceVec.size() ; i++ )
     {
-        delete garbageFaceVec[i];
+        m_FacePool.Delete( garbageFaceVec[i] );
     }
     garbageFaceVec.clear();
 }
@@ -1494,6 +1481,208 @@ bool vec2dCompare( const vec2d &a, const vec2d &b )
     return a.x() < b.x();
 }
 
+//==== Copy Mesh Into Flat Index Based Storage ====//
+void Mesh::SaveData( MeshData & data ) const
+{
+    data = MeshData();
+
+    map< Node*, int > node_ind;
+    map< Edge*, int > edge_ind;
+    map< Face*, int > face_ind;
+
+    list< Node* >::const_iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    {
+        int ind = node_ind.size();
+        node_ind[ *n ] = ind;
+    }
+    list< Edge* >::const_iterator e;
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        int ind = edge_ind.size();
+        edge_ind[ *e ] = ind;
+    }
+    list< Face* >::const_iterator f;
+    for ( f = faceList.begin() ; f != faceList.end(); ++f )
+    {
+        int ind = face_ind.size();
+        face_ind[ *f ] = ind;
+    }
+    node_ind[ NULL ] = -1;
+    edge_ind[ NULL ] = -1;
+    face_ind[ NULL ] = -1;
+
+    for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+    {
+        data.m_NodePnt.push_back( ( *n )->pnt );
+        data.m_NodeUW.push_back( ( *n )->uw );
+        data.m_NodeFixed.push_back( ( *n )->fixed );
+
+        data.m_NodeEdges.push_back( vector< int >() );
+        for ( int i = 0 ; i < ( int )( *n )->edgeVec.size() ; i++ )
+        {
+            data.m_NodeEdges.back().push_back( edge_ind[ ( *n )->edgeVec[i] ] );
+        }
+    }
+
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        data.m_EdgeNodes.push_back( node_ind[ ( *e )->n0 ] );
+        data.m_EdgeNodes.push_back( node_ind[ ( *e )->n1 ] );
+        data.m_EdgeFaces.push_back( face_ind[ ( *e )->f0 ] );
+        data.m_EdgeFaces.push_back( face_ind[ ( *e )->f1 ] );
+        data.m_EdgeRidge.push_back( ( *e )->ridge );
+        data.m_EdgeBorder.push_back( ( *e )->border );
+        data.m_EdgeDebug.push_back( ( *e )->debugFlag );
+        data.m_EdgeTargetLen.push_back( ( *e )->target_len );
+        data.m_EdgeLength.push_back( ( *e )->m_Length );
+    }
+
+    for ( f = faceList.begin() ; f != faceList.end(); ++f )
+    {
+        data.m_FaceNodes.push_back( node_ind[ ( *f )->n0 ] );
+        data.m_FaceNodes.push_back( node_ind[ ( *f )->n1 ] );
+        data.m_FaceNodes.push_back( node_ind[ ( *f )->n2 ] );
+        data.m_FaceNodes.push_back( node_ind[ ( *f )->n3 ] );
+        data.m_FaceEdges.push_back( edge_ind[ ( *f )->e0 ] );
+        data.m_FaceEdges.push_back( edge_ind[ ( *f )->e1 ] );
+        data.m_FaceEdges.push_back( edge_ind[ ( *f )->e2 ] );
+        data.m_FaceEdges.push_back( edge_ind[ ( *f )->e3 ] );
+        data.m_FaceDebug.push_back( ( *f )->debugFlag );
+    }
+
+    // Split map entries for edges no longer in the mesh are never looked up again
+    map< Edge*, Node* >::const_iterator it;
+    for ( it = m_BorderEdgeSplitNode.begin() ; it != m_BorderEdgeSplitNode.end(); ++it )
+    {
+        map< Edge*, int >::iterator eit = edge_ind.find( it->first );
+        map< Node*, int >::iterator nit = node_ind.find( it->second );
+        if ( eit != edge_ind.end() && nit != node_ind.end() )
+        {
+            data.m_BorderSplit.push_back( eit->second );
+            data.m_BorderSplit.push_back( nit->second );
+        }
+    }
+}
+
+//==== Replace Mesh With One Saved By SaveData ====//
+void Mesh::LoadData( const MeshData & data )
+{
+    DumpGarbage();
+    Clear();
+    m_BorderEdgeSplitNode.clear();
+
+    int nnode = data.m_NodePnt.size();
+    int nedge = data.m_EdgeRidge.size();
+    int nface = data.m_FaceDebug.size();
+
+    vector< Node* > nodes( nnode );
+    vector< Edge* > edges( nedge );
+    vector< Face* > faces( nface );
+
+    for ( int i = 0 ; i < nnode ; i++ )
+    {
+        nodes[i] = AddNode( data.m_NodePnt[i], data.m_NodeUW[i] );
+        nodes[i]->fixed = data.m_NodeFixed[i];
+    }
+
+    // Connections are set directly below so their order matches the saved mesh
+    for ( int i = 0 ; i < nedge ; i++ )
+    {
+        edges[i] = m_EdgePool.New( nodes[ data.m_EdgeNodes[2 * i] ], nodes[ data.m_EdgeNodes[2 * i + 1] ] );
+        edgeList.push_back( edges[i] );
+        edges[i]->list_ptr = --edgeList.end();
+
+        edges[i]->ridge = data.m_EdgeRidge[i];
+        edges[i]->border = data.m_EdgeBorder[i];
+        edges[i]->debugFlag = data.m_EdgeDebug[i];
+        edges[i]->target_len = data.m_EdgeTargetLen[i];
+        edges[i]->m_Length = data.m_EdgeLength[i];
+    }
+
+    for ( int i = 0 ; i < nface ; i++ )
+    {
+        const int* fn = &data.m_FaceNodes[4 * i];
+        const int* fe = &data.m_FaceEdges[4 * i];
+
+        if ( fn[3] >= 0 )
+        {
+            faces[i] = m_FacePool.New( nodes[ fn[0] ], nodes[ fn[1] ], nodes[ fn[2] ], nodes[ fn[3] ],
+                                       edges[ fe[0] ], edges[ fe[1] ], edges[ fe[2] ], edges[ fe[3] ] );
+        }
+        else
+        {
+            faces[i] = m_FacePool.New( nodes[ fn[0] ], nodes[ fn[1] ], nodes[ fn[2] ],
+                                       edges[ fe[0] ], edges[ fe[1] ], edges[ fe[2] ] );
+        }
+        faceList.push_back( faces[i] );
+        faces[i]->list_ptr = --faceList.end();
+        faces[i]->debugFlag = data.m_FaceDebug[i];
+    }
+
+    for ( int i = 0 ; i < nnode ; i++ )
+    {
+        const vector< int > & node_edges = data.m_NodeEdges[i];
+        for ( int j = 0 ; j < ( int )node_edges.size() ; j++ )
+        {
+            nodes[i]->edgeVec.push_back( edges[ node_edges[j] ] );
+        }
+    }
+
+    for ( int i = 0 ; i < nedge ; i++ )
+    {
+        int f0 = data.m_EdgeFaces[2 * i];
+        int f1 = data.m_EdgeFaces[2 * i + 1];
+        edges[i]->f0 = ( f0 >= 0 ) ? faces[ f0 ] : NULL;
+        edges[i]->f1 = ( f1 >= 0 ) ? faces[ f1 ] : NULL;
+    }
+
+    for ( int i = 0 ; i < ( int )data.m_BorderSplit.size() ; i += 2 )
+    {
+        m_BorderEdgeSplitNode[ edges[ data.m_BorderSplit[i] ] ] = nodes[ data.m_BorderSplit[i + 1] ];
+    }
+}
+
+//==== Everything Remesh Reads - Equal Keys Give Equal Remesh Results ====//
+void Mesh::GetRemeshKey( vector< double > & key ) const
+{
+    MeshData data;
+    SaveData( data );
+
+    key.clear();
+    m_Surf->GetRemeshKey( key );
+    key.push_back( m_GridDensity->m_MinLen );
+    key.push_back( m_GridDensity->m_GrowRatio );
+
+    key.push_back( data.m_NodePnt.size() );
+    for ( int i = 0 ; i < ( int )data.m_NodePnt.size() ; i++ )
+    {
+        key.push_back( data.m_NodePnt[i].x() );
+        key.push_back( data.m_NodePnt[i].y() );
+        key.push_back( data.m_NodePnt[i].z() );
+        key.push_back( data.m_NodeUW[i].x() );
+        key.push_back( data.m_NodeUW[i].y() );
+        key.push_back( data.m_NodeFixed[i] );
+        key.push_back( data.m_NodeEdges[i].size() );
+        key.insert( key.end(), data.m_NodeEdges[i].begin(), data.m_NodeEdges[i].end() );
+    }
+
+    key.push_back( data.m_EdgeRidge.size() );
+    key.insert( key.end(), data.m_EdgeNodes.begin(), data.m_EdgeNodes.end() );
+    key.insert( key.end(), data.m_EdgeFaces.begin(), data.m_EdgeFaces.end() );
+    key.insert( key.end(), data.m_EdgeRidge.begin(), data.m_EdgeRidge.end() );
+    key.insert( key.end(), data.m_EdgeBorder.begin(), data.m_EdgeBorder.end() );
+    key.insert( key.end(), data.m_EdgeDebug.begin(), data.m_EdgeDebug.end() );
+
+    key.push_back( data.m_FaceDebug.size() );
+    key.insert( key.end(), data.m_FaceNodes.begin(), data.m_FaceNodes.end() );
+    key.insert( key.end(), data.m_FaceEdges.begin(), data.m_FaceEdges.end() );
+    key.insert( key.end(), data.m_FaceDebug.begin(), data.m_FaceDebug.end() );
+
+    key.push_back( data.m_BorderSplit.size() );
+    key.insert( key.end(), data.m_BorderSplit.begin(), data.m_BorderSplit.end() );
+}
+
 void Mesh::InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_indexes, SurfaceIntersectionSingleton *MeshMgr )
 {
     assert( m_Surf );
@@ -1629,9 +1818,6 @@ void Mesh::InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_index
     triangleio in, out;
     int tristatus = TRI_NULL;
 
-    // init
-    ctx = triangle_context_create();
-
     memset( &in, 0, sizeof( in ) ); // Load Zeros
     memset( &out, 0, sizeof( out ) );
 
@@ -1709,13 +1895,21 @@ void Mesh::InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_index
 
     sprintf( str, "zpYYQa%8.6fq20", uw_tri_area );
 
-    //==== Constrained Delaunay Trianglulation ====//
-    tristatus = triangle_context_options( ctx, str );
-    if ( tristatus != TRI_OK ) printf( _("triangle_context_options Error\n") );
+    {
+        // Triangle keeps its exact arithmetic constants and random seed in globals
+        std::lock_guard< std::mutex > lock( ParallelUtil::TriangleMutex() );
+
+        // init
+        ctx = triangle_context_create();
 
-    // Triangulate the polygon
-    tristatus = triangle_mesh_create( ctx, &in );
-    if ( tristatus != TRI_OK ) printf( _("triangle_mesh_create Error\n") );
+        //==== Constrained Delaunay Trianglulation ====//
+        tristatus = triangle_context_options( ctx, str );
+        if ( tristatus != TRI_OK ) printf( _("triangle_context_options Error\n") );
+
+        // Triangulate the polygon
+        tristatus = triangle_mesh_create( ctx, &in );
+        if ( tristatus != TRI_OK ) printf( _("triangle_mesh_create Error\n") );
+    }
 
 
     //==== Clear All Node, Edge, Tri Data ====//
@@ -26,6 +26,7 @@ class SurfaceIntersectionSingleton;
 #endif
 
 #include <cassert>
+#include <new>
 
 #include <vector>
 #include <list>
@@ -39,6 +40,94 @@ public:
     vec2d m_UWmid;
 };
 
+//==== Flat Copy Of A Mesh - Nodes, Edges and Faces Referenced By List Index ====//
+class MeshData
+{
+public:
+    vector< vec3d > m_NodePnt;
+    vector< vec2d > m_NodeUW;
+    vector< bool > m_NodeFixed;
+    vector< vector< int > > m_NodeEdges;        // Node::edgeVec, in order
+
+    vector< int > m_EdgeNodes;                  // n0, n1 for each edge
+    vector< int > m_EdgeFaces;                  // f0, f1 for each edge, -1 if none
+    vector< bool > m_EdgeRidge;
+    vector< bool > m_EdgeBorder;
+    vector< bool > m_EdgeDebug;
+    vector< double > m_EdgeTargetLen;
+    vector< double > m_EdgeLength;
+
+    vector< int > m_FaceNodes;                  // n0 - n3 for each face, -1 if tri
+    vector< int > m_FaceEdges;                  // e0 - e3 for each face, -1 if tri
+    vector< bool > m_FaceDebug;
+
+    vector< int > m_BorderSplit;                // Edge, node pairs of m_BorderEdgeSplitNode
+
+    int GetNumFaces() const
+    {
+        return m_FaceDebug.size();
+    }
+};
+
+//==== Block Storage For Mesh Nodes, Edges and Faces - Freed Slots Are Reused ====//
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool()
+    {
+        m_NumUsed = BLOCK_SIZE;
+    }
+    ~MeshPool()
+    {
+        // Objects must all be freed by now, only the storage is released
+        for ( int i = 0 ; i < ( int )m_BlockVec.size() ; i++ )
+        {
+            ::operator delete( m_BlockVec[i] );
+        }
+    }
+
+    template < class... Args >
+    T* New( Args... args )
+    {
+        void* mem;
+        if ( !m_FreeVec.empty() )
+        {
+            mem = m_FreeVec.back();
+            m_FreeVec.pop_back();
+        }
+        else
+        {
+            if ( m_NumUsed == BLOCK_SIZE )
+            {
+                m_BlockVec.push_back( static_cast< T* >( ::operator new( BLOCK_SIZE * sizeof( T ) ) ) );
+                m_NumUsed = 0;
+            }
+            mem = m_BlockVec.back() + m_NumUsed;
+            m_NumUsed++;
+        }
+        return new ( mem ) T( args... );
+    }
+
+    void Delete( T* ptr )
+    {
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+    }
+
+private:
+
+    MeshPool( const MeshPool & );
+    MeshPool & operator=( const MeshPool & );
+
+    enum { BLOCK_SIZE = 1024 };
+
+    vector< T* > m_BlockVec;
+    int m_NumUsed;              // Slots used in the last block
+    vector< T* > m_FreeVec;
+};
+
 //////////////////////////////////////////////////////////////////////
 class Mesh
 {
@@ -105,6 +194,10 @@ public:
     Face* AddFace( Node* nn0, Node* nn1, Node* nn2, Node* nn3, Edge* ee0, Edge* ee1, Edge* ee2, Edge* ee3 );
     void  RemoveFace( Face* fptr );
 
+    void SaveData( MeshData & data ) const;
+    void LoadData( const MeshData & data );
+    void GetRemeshKey( vector< double > & key ) const;
+
     void InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_indexes, SurfaceIntersectionSingleton *MeshMgr );
 
     void ReadSTL( const char* file_name );
@@ -179,6 +272,10 @@ protected:
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    MeshPool< Face > m_FacePool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Node > m_NodePool;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
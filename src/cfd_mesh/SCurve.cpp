@@ -270,15 +270,24 @@ void SCurve::BuildDistTable( SimpleGridDensity* grid_den, SCurve* BCurve, list<
         }
         num_segs = nref * m_UWCrv.GetNumSections() + 1;
     }
+    vector< vec3d > uw_vec( num_segs );
+    for ( int i = 0 ; i < num_segs ; i++ )
+    {
+        double u = ( double )i / ( double )( num_segs - 1 );
+        uw_vec[i] = m_UWCrv.CompPnt01( u );
+    }
+
+    vector< vec3d > surf_pnt_vec;
+    m_Surf->CompPnts( uw_vec, surf_pnt_vec );
+
     double total_dist = 0.0;
-    vec3d uw = m_UWCrv.CompPnt01( 0 );
-    vec3d last_p = m_Surf->CompPnt( uw.x(), uw.y() );
+    vec3d last_p = surf_pnt_vec[0];
     for ( int i = 0 ; i < num_segs ; i++ )
     {
         double u = ( double )i / ( double )( num_segs - 1 );
 
-        uw = m_UWCrv.CompPnt01( u );
-        vec3d p = m_Surf->CompPnt( uw.x(), uw.y() );
+        vec3d uw = uw_vec[i];
+        vec3d p = surf_pnt_vec[i];
 
         double t = GetTargetLen( grid_den, BCurve, p, uw, u );
 
@@ -14,9 +14,9 @@ class SimpleBC
 public:
     SimpleBC();
 
-    void CopyFrom( FeaBC* fea_bc );
+    void CopyFrom( FeaBC* fea_bc, const vector < string > & part_id_vec, int subsurf_index );
 
-    void ApplyTo( FeaNode* node );
+    void ApplyTo( FeaNode* node, int num_fea_parts );
 
     int m_BCType;
     BitMask m_Constraints;
@@ -391,6 +391,11 @@ double SimpleGridDensity::GetFarRadFrac()
 }
 
 double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string & geomid, const int & surfindx, const double & u, const double & w )
+{
+    return GetTargetLen( m_Sources, pos, farFlag, geomid, surfindx, u, w );
+}
+
+double SimpleGridDensity::GetTargetLen( const vector< BaseSimpleSource* > & sources, vec3d& pos, bool farFlag, const string & geomid, const int & surfindx, const double & u, const double & w )
 {
     double target_len;
     double base_len;
@@ -405,9 +410,9 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     }
     base_len = target_len;
 
-    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    for ( int i = 0; i < (int)sources.size(); i++ )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        double len = sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
         if ( len < target_len )
         {
             target_len = len;
@@ -416,6 +421,23 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     return target_len;
 }
 
+void SimpleGridDensity::GetCullSources( const BndBox & box, vector< BaseSimpleSource* > & sources )
+{
+    sources.clear();
+
+    // Points evaluated on a surface may sit a round off outside its box
+    double tol = 1.0e-6 * box.DiagDist();
+
+    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    {
+        BndBox src_box;
+        if ( !m_Sources[i]->GetCullBBox( src_box ) || Compare( src_box, box, tol ) )
+        {
+            sources.push_back( m_Sources[i] );
+        }
+    }
+}
+
 void SimpleGridDensity::ScaleMesh( double scale )
 {
     m_BaseLen *= scale;
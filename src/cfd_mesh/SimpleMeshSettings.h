@@ -182,6 +182,10 @@ public:
     double GetRadFrac( bool farflag );
     double GetFarRadFrac();
     double GetTargetLen( vec3d& pos, bool farFlag = false, const string & geomid = string(), const int & surfindx = 0, const double & u = 0.0, const double &w = 0.0 );
+    double GetTargetLen( const vector< BaseSimpleSource* > & sources, vec3d& pos, bool farFlag, const string & geomid, const int & surfindx, const double & u, const double &w );
+
+    // Sources that may reduce the target length somewhere inside box
+    void GetCullSources( const BndBox & box, vector< BaseSimpleSource* > & sources );
 
     void ClearSources()
     {
@@ -135,7 +135,18 @@ double Surf::TargetLen( double u, double w, double gap, double radfrac )
     return len;
 }
 
-void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
+void Surf::GetCurvMapKey( vector< double > & key )
+{
+    bool limitFlag = m_FarFlag || m_SymPlaneFlag;
+
+    key.clear();
+    key.push_back( m_NumMap );
+    key.push_back( m_GridDensityPtr->GetMaxGap( limitFlag ) );
+    key.push_back( m_GridDensityPtr->GetRadFrac( limitFlag ) );
+    m_SurfCore.GetControlData( key );
+}
+
+void Surf::BuildTargetMap( int sid, CurvTargetMap & curv_map )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
     int npatchw = m_SurfCore.GetNumWPatches();
@@ -165,6 +176,29 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
+    // Points and curvature only depend on the surface, reuse them from an earlier mesh if possible
+    bool curv_valid = ( curv_map.m_Pnts.size() == nmapu * nmapw && curv_map.m_Len.size() == nmapu * nmapw );
+    if ( !curv_valid )
+    {
+        vector< double > uvec( nmapu );
+        for( int i = 0; i < nmapu ; i++ )
+        {
+            uvec[i] = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
+        }
+        vector< double > wvec( nmapw );
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            wvec[j] = wmin + dw * ( 1.0 * j ) / ( nmapw - 1 );
+        }
+
+        m_SurfCore.CompPntGrid( uvec, wvec, curv_map.m_Pnts );
+        curv_map.m_Len.resize( nmapu * nmapw );
+    }
+
+    // Only sources that reach this surface
+    vector< BaseSimpleSource* > sources;
+    m_GridDensityPtr->GetCullSources( m_BBox, sources );
+
     // Loop over surface evaluating source strength and curvature
     for( int i = 0; i < nmapu ; i++ )
     {
@@ -173,23 +207,29 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         {
             double w = wmin + dw * ( 1.0 * j ) / ( nmapw - 1 );
 
+            int k = i * nmapw + j;
+            if ( !curv_valid )
+            {
+                curv_map.m_Len[k] = TargetLen( u, w, m_GridDensityPtr->GetMaxGap( limitFlag ), m_GridDensityPtr->GetRadFrac( limitFlag ) );
+            }
+
             double len = numeric_limits<double>::max( );
 
             // apply curvature based limits
-            double curv_len = TargetLen( u, w, m_GridDensityPtr->GetMaxGap( limitFlag ), m_GridDensityPtr->GetRadFrac( limitFlag ) );
+            double curv_len = curv_map.m_Len[k];
             len = min( len, curv_len );
 
             // apply minimum edge length as safety on curvature
             len = max( len, m_GridDensityPtr->m_MinLen );
 
             // apply sources
-            vec3d p = m_SurfCore.CompPnt( u, w );
+            vec3d p = curv_map.m_Pnts[k];
 
             // The last four parameters passed here (m_GeomID, m_MainSurfID, u, w)
             // represent a significant layering violation.  This is needed to allow
             // constant U/W line sources to do some evaluation in u,w space instead
             // of just x,y,z space.
-            double grid_len = m_GridDensityPtr->GetTargetLen( p, limitFlag, m_GeomID, m_MainSurfID, u, w );
+            double grid_len = m_GridDensityPtr->GetTargetLen( sources, p, limitFlag, m_GeomID, m_MainSurfID, u, w );
             len = min( len, grid_len );
 
             // finally check max size
@@ -197,6 +237,16 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
 
             MapSource ms = MapSource( p, len, sid );
             m_SrcMap[i][j] = ms;
+        }
+    }
+}
+
+void Surf::LoadMapSources( vector< MapSource* > &sources )
+{
+    for( int i = 0; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        for( int j = 0; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
             sources.push_back( &( m_SrcMap[i][j] ) );
         }
     }
@@ -436,6 +486,24 @@ double Surf::InterpTargetMap( double u, double w )
     return t;
 }
 
+//==== Everything Mesh::Remesh Reads From The Surface - Geometry, Orientation and Target Map ====//
+void Surf::GetRemeshKey( vector< double > & key )
+{
+    key.push_back( m_FlipFlag );
+    m_SurfCore.GetControlData( key );
+
+    key.push_back( m_NumMap );
+    key.push_back( m_SrcMap.size() );
+    for ( int i = 0 ; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        key.push_back( m_SrcMap[i].size() );
+        for ( int j = 0 ; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            key.push_back( m_SrcMap[i][j].m_str );
+        }
+    }
+}
+
 void Surf::UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj )
 {
     int npatchu = m_SurfCore.GetNumUPatches();
@@ -651,40 +719,27 @@ void Surf::WriteSTL( const char* filename )
     m_Mesh.WriteSTL( filename );
 }
 
-void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
+bool Surf::CheckIntersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
 {
-    int i;
-
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr, MeshMgr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this, MeshMgr ) )
     {
-        return;
+        return false;
     }
 
-    vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
-        if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
-        {
-            for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
-            {
-                if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
-                {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], MeshMgr );
-                }
-            }
-        }
+    return true;
 }
 
 void Surf::IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals )
@@ -866,6 +921,9 @@ void Surf::InitMesh( vector< ISegChain* > chains, const vector < vec2d > &adduw,
 
     vector < vec2d > uwPntVec;
 
+    //==== Index Kept Locally, IPnts Are Shared With Surfs Meshed On Other Threads ====//
+    map< IPnt*, int > ipntIndex;
+
     set< IPnt* >::iterator ip;
     for ( ip = ipntSet.begin() ; ip != ipntSet.end() ; ++ip )
     {
@@ -885,12 +943,12 @@ void Surf::InitMesh( vector< ISegChain* > chains, const vector < vec2d > &adduw,
 
         if ( min_dist < 1.0e-4 )
         {
-            ( *ip )->m_Index = min_id;
+            ipntIndex[ *ip ] = min_id;
         }
         else
         {
             uwPntVec.push_back( uw );
-            ( *ip )->m_Index = uwPntVec.size() - 1;
+            ipntIndex[ *ip ] = uwPntVec.size() - 1;
         }
     }
 
@@ -908,8 +966,8 @@ void Surf::InitMesh( vector< ISegChain* > chains, const vector < vec2d > &adduw,
         int nhalf = 0.5 * ( n - 1 )  + 1;
         for ( int j = 0 ; j < nhalf - 1; j++ )
         {
-            seg.m_Index[0] = chains[i]->m_TessVec[2 * j]->m_Index;
-            seg.m_Index[1] = chains[i]->m_TessVec[2 * (j + 1)]->m_Index;
+            seg.m_Index[0] = ipntIndex[ chains[i]->m_TessVec[2 * j] ];
+            seg.m_Index[1] = ipntIndex[ chains[i]->m_TessVec[2 * (j + 1)] ];
             seg.m_UWmid = chains[i]->m_TessVec[2 * j + 1]->GetPuw( this )->m_UW;
             isegVec.push_back( seg );
         }
@@ -1013,17 +1071,22 @@ void Surf::BuildDistMap()
     double VspdW = VspMaxW - VspMinW;
 
     //==== Load Point Vec ====//
+    vector< double > uvec( nump );
+    vector< double > wvec( nump );
+    for ( i = 0 ; i < nump ; i++ )
+    {
+        uvec[i] = VspMinU + VspdU * ( double )i / ( double )( nump - 1 );
+        wvec[i] = VspMinW + VspdW * ( double )i / ( double )( nump - 1 );
+    }
+
+    vector< vec3d > pnts;
+    m_SurfCore.CompPntGrid( uvec, wvec, pnts );
+
     vector< vector< vec3d > > pvec;
     pvec.resize( nump );
     for ( i = 0 ; i < nump ; i++ )
     {
-        pvec[i].resize( nump );
-        double u = VspMinU + VspdU * ( double )i / ( double )( nump - 1 );
-        for ( j = 0 ; j < nump ; j++ )
-        {
-            double w = VspMinW + VspdW * ( double )j / ( double )( nump - 1 );
-            pvec[i][j] = m_SurfCore.CompPnt( u, w );
-        }
+        pvec[i].assign( pnts.begin() + i * nump, pnts.begin() + ( i + 1 ) * nump );
     }
 
     //==== Find U Dists ====//
@@ -1442,6 +1505,11 @@ vec3d Surf::CompPnt( double u, double w ) const
     return m_SurfCore.CompPnt( u, w );
 }
 
+void Surf::CompPnts( const vector< vec3d > & uw, vector< vec3d > & pnts ) const
+{
+    m_SurfCore.CompPnts( uw, pnts );
+}
+
 vec3d Surf::CompPnt01( double u, double w ) const
 {
     return m_SurfCore.CompPnt01( u, w );
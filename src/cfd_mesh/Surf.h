@@ -33,6 +33,14 @@ class SurfaceIntersectionSingleton;
 class SCurve;
 class ISegChain;
 
+//==== Points And Curvature Based Lengths Of A Target Map, Kept Between Meshes ====//
+class CurvTargetMap
+{
+public:
+    vector< vec3d > m_Pnts;
+    vector< double > m_Len;
+};
+
 //////////////////////////////////////////////////////////////////////
 class Surf
 {
@@ -47,6 +55,7 @@ public:
     int UWPointOnBorder( double u, double w, double tol ) const;
 
     vec3d CompPnt( double u, double w ) const;
+    void CompPnts( const vector< vec3d > & uw, vector< vec3d > & pnts ) const;
     vec3d CompPnt01( double u, double w ) const;
     vec3d CompNorm( double u, double w ) const;
 
@@ -61,12 +70,15 @@ public:
     }
 
     double TargetLen( double u, double w, double gap, double radfrac );
-    void BuildTargetMap( vector< MapSource* > &sources, int sid );
+    void GetCurvMapKey( vector< double > & key );
+    void BuildTargetMap( int sid, CurvTargetMap & curv_map );
+    void LoadMapSources( vector< MapSource* > &sources );
     void WalkMap( int istart, int jstart, int kstart );
     void WalkMap( int istart, int jstart );
     void LimitTargetMap();
     void LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minmap );
     double InterpTargetMap( double u, double w );
+    void GetRemeshKey( vector< double > & key );
     void UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj );
     void UWtoTargetMapij( double u, double w, int &i, int &j );
 
@@ -153,7 +165,8 @@ public:
         return &m_Mesh;
     }
 
-    void Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    // Returns true if the patches of the two surfaces must be intersected
+    bool CheckIntersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
     bool BorderCurveOnSurface( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
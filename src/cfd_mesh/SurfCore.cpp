@@ -8,6 +8,8 @@
 
 #include <intl.h>
 
+#include <algorithm>
+
 typedef piecewise_surface_type::bounding_box_type surface_bounding_box_type;
 
 SurfCore::SurfCore()
@@ -173,6 +175,188 @@ vec3d SurfCore::CompPnt( double u, double w ) const
     return rtn;
 }
 
+//==== Bernstein Polynomials Of Degree n At t ====//
+static void BernsteinBasis( int n, double t, double *b )
+{
+    double s = 1.0 - t;
+
+    b[0] = 1.0;
+    for ( int j = 1 ; j <= n ; j++ )
+    {
+        double saved = 0.0;
+        for ( int i = 0 ; i < j ; i++ )
+        {
+            double tmp = b[i];
+            b[i] = saved + s * tmp;
+            saved = t * tmp;
+        }
+        b[j] = saved;
+    }
+}
+
+//==== Segment Of pmap Holding t, Trying seg First ====//
+// Like Code-Eli, a breakpoint belongs to the segment it starts.
+static int FindSegment( const vector< double > & pmap, double t, int seg, double & tloc )
+{
+    int nseg = ( int )pmap.size() - 1;
+
+    if ( seg < 0 || seg >= nseg || t < pmap[seg] || ( t >= pmap[seg + 1] && seg < nseg - 1 ) )
+    {
+        seg = ( int )( upper_bound( pmap.begin(), pmap.end(), t ) - pmap.begin() ) - 1;
+        seg = max( 0, min( seg, nseg - 1 ) );
+    }
+
+    tloc = ( t - pmap[seg] ) / ( pmap[seg + 1] - pmap[seg] );
+    tloc = max( 0.0, min( tloc, 1.0 ) );
+    return seg;
+}
+
+//==== Evaluates Points On One Surface, Keeping The Last Patch And Basis ====//
+class SurfPatchEval
+{
+public:
+    SurfPatchEval( const piecewise_surface_type & surf ) : m_Surface( surf )
+    {
+        m_Surface.get_pmap_uv( m_UPmap, m_WPmap );
+        m_UMin = m_Surface.get_u0();
+        m_WMin = m_Surface.get_v0();
+        m_UMax = m_Surface.get_umax();
+        m_WMax = m_Surface.get_vmax();
+        m_IP = -1;
+        m_JP = -1;
+        m_DegU = -1;
+        m_DegW = -1;
+        m_BasisU = -1.0;
+        m_BasisW = -1.0;
+    }
+
+    vec3d CompPnt( double u, double w )
+    {
+        u = max( m_UMin, min( u, m_UMax ) );
+        w = max( m_WMin, min( w, m_WMax ) );
+
+        double uloc, wloc;
+        int ip = FindSegment( m_UPmap, u, m_IP, uloc );
+        int jp = FindSegment( m_WPmap, w, m_JP, wloc );
+
+        if ( ip != m_IP || jp != m_JP )
+        {
+            LoadPatch( ip, jp );
+        }
+
+        if ( uloc != m_BasisU )
+        {
+            BernsteinBasis( m_DegU, uloc, &m_BU[0] );
+            m_BasisU = uloc;
+        }
+        if ( wloc != m_BasisW )
+        {
+            BernsteinBasis( m_DegW, wloc, &m_BW[0] );
+            m_BasisW = wloc;
+        }
+
+        //==== Tensor Product Sum ====//
+        const double *cp = &m_CP[0];
+        double x = 0, y = 0, z = 0;
+        for ( int i = 0 ; i <= m_DegU ; i++ )
+        {
+            double sx = 0, sy = 0, sz = 0;
+            for ( int j = 0 ; j <= m_DegW ; j++ )
+            {
+                double b = m_BW[j];
+                sx += b * cp[0];
+                sy += b * cp[1];
+                sz += b * cp[2];
+                cp += 3;
+            }
+            x += m_BU[i] * sx;
+            y += m_BU[i] * sy;
+            z += m_BU[i] * sz;
+        }
+        return vec3d( x, y, z );
+    }
+
+private:
+
+    void LoadPatch( int ip, int jp )
+    {
+        const surface_patch_type *epatch = m_Surface.get_patch( ip, jp );
+
+        int n = epatch->degree_u();
+        int m = epatch->degree_v();
+
+        m_CP.resize( 3 * ( n + 1 ) * ( m + 1 ) );
+        int k = 0;
+        for ( int i = 0 ; i <= n ; i++ )
+        {
+            for ( int j = 0 ; j <= m ; j++ )
+            {
+                surface_point_type p = epatch->get_control_point( i, j );
+                m_CP[k++] = p.x();
+                m_CP[k++] = p.y();
+                m_CP[k++] = p.z();
+            }
+        }
+
+        //==== Basis Depends On The Degree, Recompute On Change ====//
+        if ( n != m_DegU )
+        {
+            m_BU.resize( n + 1 );
+            m_BasisU = -1.0;
+        }
+        if ( m != m_DegW )
+        {
+            m_BW.resize( m + 1 );
+            m_BasisW = -1.0;
+        }
+
+        m_IP = ip;
+        m_JP = jp;
+        m_DegU = n;
+        m_DegW = m;
+    }
+
+    const piecewise_surface_type & m_Surface;
+
+    vector< double > m_UPmap;
+    vector< double > m_WPmap;
+    double m_UMin, m_WMin, m_UMax, m_WMax;
+
+    int m_IP, m_JP;
+    int m_DegU, m_DegW;
+    vector< double > m_CP;      // x, y, z of the active patch, w fastest
+
+    double m_BasisU, m_BasisW;  // Local parameters of m_BU and m_BW
+    vector< double > m_BU;
+    vector< double > m_BW;
+};
+
+void SurfCore::CompPnts( const vector< vec3d > & uw, vector< vec3d > & pnts ) const
+{
+    SurfPatchEval seval( m_Surface );
+
+    pnts.resize( uw.size() );
+    for ( int i = 0 ; i < ( int )uw.size() ; i++ )
+    {
+        pnts[i] = seval.CompPnt( uw[i].x(), uw[i].y() );
+    }
+}
+
+void SurfCore::CompPntGrid( const vector< double > & u, const vector< double > & w, vector< vec3d > & pnts ) const
+{
+    SurfPatchEval seval( m_Surface );
+
+    int nw = w.size();
+    pnts.resize( u.size() * nw );
+    for ( int i = 0 ; i < ( int )u.size() ; i++ )
+    {
+        for ( int j = 0 ; j < nw ; j++ )
+        {
+            pnts[ i * nw + j ] = seval.CompPnt( u[i], w[j] );
+        }
+    }
+}
+
 //===== Compute Surface Curvature Metrics Given  U W =====//
 void SurfCore::CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const
 {
@@ -716,6 +900,45 @@ void SurfCore::BuildPatches( Surf* srf ) const
     srf->SetPatchVec( patchVec );
 }
 
+void SurfCore::GetControlData( vector< double > & data ) const
+{
+    data.push_back( m_Surface.number_u_patches() );
+    data.push_back( m_Surface.number_v_patches() );
+
+    for ( int ip = 0; ip < m_Surface.number_u_patches(); ip++ )
+    {
+        for ( int jp = 0; jp < m_Surface.number_v_patches(); jp++ )
+        {
+            double umin = 0;
+            double du = 0;
+            double vmin = 0;
+            double dv = 0;
+            const surface_patch_type *epatch = m_Surface.get_patch( ip, jp, umin, du, vmin, dv );
+
+            int n = epatch->degree_u();
+            int m = epatch->degree_v();
+
+            data.push_back( umin );
+            data.push_back( du );
+            data.push_back( vmin );
+            data.push_back( dv );
+            data.push_back( n );
+            data.push_back( m );
+
+            for ( int i = 0; i <= n; i++ )
+            {
+                for ( int j = 0; j <= m; j++ )
+                {
+                    vec3d cp = epatch->get_control_point( i, j );
+                    data.push_back( cp.x() );
+                    data.push_back( cp.y() );
+                    data.push_back( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 double SurfCore::FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0 ) const
 {
     double dist;
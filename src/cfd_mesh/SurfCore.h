@@ -49,6 +49,13 @@ public:
 
     vec3d CompPnt01( double u, double w ) const;
 
+    //===== Batched Bezier Funcs ====//
+    // Points for many parameters at once, uw holds u and w in x and y.  The
+    // patch of the previous point is reused while it still holds the next one.
+    void CompPnts( const vector< vec3d > & uw, vector< vec3d > & pnts ) const;
+    // Points at every ( u[i], w[j] ), stored at pnts[ i * w.size() + j ].
+    void CompPntGrid( const vector< double > & u, const vector< double > & w, vector< vec3d > & pnts ) const;
+
     void CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
 
     int UWPointOnBorder( double u, double w, double tol ) const;
@@ -121,6 +128,9 @@ public:
 
     void BuildPatches( Surf* srf ) const;
 
+    // Append the patch layout, parameter ranges and control points.  Equal data means an equal surface.
+    void GetControlData( vector< double > & data ) const;
+
     double FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0 ) const;
     double FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0, double umin, double umax, double vmin, double vmax ) const;
     double FindNearest( double &u, double &w, const vec3d &pt ) const;
@@ -42,6 +42,7 @@ typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
 
 class Surf;
 class SurfPatch;
+class PatchISeg;
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
 
@@ -109,7 +110,7 @@ public:
     {
         return &bnd_box;
     }
-    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
     void find_closest_uw( const vec3d& pnt_in, const double guess_uw[2],double uw[2] ) const;
     void find_closest_uw_planar_approx( const vec3d& pnt_in, double uw[2] ) const;
 
@@ -127,7 +128,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, vector< PatchISeg > & isegs );
 
     vector < vec3d > GetPatchDrawLines() const;
 
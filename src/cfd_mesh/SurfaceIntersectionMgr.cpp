@@ -349,6 +349,8 @@ SurfaceIntersectionSingleton::SurfaceIntersectionSingleton() : ParmContainer()
 
     m_MessageName = "SurfIntersectMessage";
 
+    m_NumMeshThreads = 0;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = string( "MeshDebug/" );
     mkdir( m_DebugDir.c_str(), 0777 );
@@ -626,10 +628,14 @@ int SurfaceIntersectionSingleton::GetSimpSubSurfIndex( string ss_id )
     return -1;
 }
 
+std::mutex SurfaceIntersectionSingleton::m_OutputMutex;
+
 void SurfaceIntersectionSingleton::addOutputText( string str, int output_type )
 {
     if ( output_type != QUIET_OUTPUT )
     {
+        std::lock_guard< std::mutex > lock( m_OutputMutex );
+
 #ifdef DEBUG_TIME_OUTPUT
         static auto tprev = std::chrono::high_resolution_clock::now();
         auto tnow = std::chrono::high_resolution_clock::now();
@@ -646,6 +652,16 @@ void SurfaceIntersectionSingleton::addOutputText( string str, int output_type )
     }
 }
 
+int SurfaceIntersectionSingleton::GetNumMeshThreads()
+{
+#ifdef DEBUG_CFD_MESH
+    // Debug files are numbered by static counters, keep them in surface order
+    return 1;
+#else
+    return m_NumMeshThreads;
+#endif
+}
+
 void SurfaceIntersectionSingleton::FetchSurfs( vector< XferSurf > &xfersurfs )
 {
     m_Vehicle->FetchXFerSurfs( GetSettingsPtr()->m_SelectedSetIndex, xfersurfs );
@@ -1688,30 +1704,19 @@ void SurfaceIntersectionSingleton::BuildNURBSCurvesVec()
 
 void SurfaceIntersectionSingleton::BuildCurves()
 {
-    list< ISegChain* >::iterator c;
-    for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
+    vector< ISegChain* > chains( m_ISegChainList.begin(), m_ISegChainList.end() );
+
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
-        ( *c )->BuildCurves();
-    }
+        chains[i]->BuildCurves();
+    }, GetNumMeshThreads() );
 }
 
 void SurfaceIntersectionSingleton::Intersect()
 {
-    char str[256];
-
     if ( GetSettingsPtr()->m_IntersectSubSurfs ) BuildSubSurfIntChains();
 
-    //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
-    for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
-    {
-        sprintf( str, _("Intersect %d/%d\n"), i + 1, m_SurfVec.size() );
-        addOutputText( str );
-
-        for ( int j = i + 1; j < (int) m_SurfVec.size(); j++ )
-        {
-            m_SurfVec[i]->Intersect( m_SurfVec[j], this );
-        }
-    }
+    IntersectPatches();
 
     // WriteISegs();
 
@@ -1745,110 +1750,181 @@ void SurfaceIntersectionSingleton::Intersect()
     // DebugWriteChains( "BuildCurves", false );
 }
 
-void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 )
+void SurfaceIntersectionSingleton::IntersectPatches()
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
+    int nsurf = ( int )m_SurfVec.size();
+
+    //==== Surface Pairs To Intersect ====//
+    // Border curve checks add ICurves, so they stay serial and in order.
+    vector< vector< bool > > check_pair( nsurf, vector< bool >( nsurf, false ) );
+    for ( int i = 0 ; i < nsurf ; i++ )
     {
-        return;
+        for ( int j = i + 1 ; j < nsurf ; j++ )
+        {
+            check_pair[i][j] = m_SurfVec[i]->CheckIntersect( m_SurfVec[j], this );
+        }
+    }
+
+    //==== Bounding Box Tree Over All Patches ====//
+    vector< SurfPatch* > patch_vec;
+    vector< int > patch_surf;
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        vector< SurfPatch* > & surf_patches = m_SurfVec[i]->GetPatchVec();
+        for ( int p = 0 ; p < ( int )surf_patches.size() ; p++ )
+        {
+            patch_vec.push_back( surf_patches[p] );
+            patch_surf.push_back( i );
+        }
     }
+    int npatch = ( int )patch_vec.size();
 
-    vec2d plane_uwA0;
-    pA.find_closest_uw_planar_approx( ip0, plane_uwA0.v );
+    vector< int > patch_ind( npatch );
+    for ( int p = 0 ; p < npatch ; p++ )
+    {
+        patch_ind[p] = p;
+    }
 
-    vec2d plane_uwB0;
-    pB.find_closest_uw_planar_approx( ip0, plane_uwB0.v );
+    SurfPatchBox patch_box;
+    patch_box.m_PatchInd = &patch_ind;
+    patch_box.m_PatchVec = &patch_vec;
+    patch_box.m_BeginInd = 0;
+    patch_box.m_EndInd = npatch;
+    patch_box.BuildSubDivide();
 
-    vec2d plane_uwA1;
-    pA.find_closest_uw_planar_approx( ip1, plane_uwA1.v );
+    //==== Overlapping Patches On Later Surfaces, In Surface Then Patch Order ====//
+    vector< vector< int > > overlap( npatch );
+    ParallelUtil::ParallelFor( npatch, [&]( int p )
+    {
+        int i = patch_surf[p];
 
-    vec2d plane_uwB1;
-    pB.find_closest_uw_planar_approx( ip1, plane_uwB1.v );
+        vector< int > hits;
+        patch_box.FindOverlap( *patch_vec[p]->get_bbox(), hits );
 
-    // Intersections that lie exactly on a patch boundary will actually intersect both patches
-    // that share that boundary.  So, detect intersections that lie on the patch minimum edge
-    // and don't carry those forward.  Don't do this if the minimum parameter is zero.  I.e.
-    // there is no prior patch.
+        for ( int h = 0 ; h < ( int )hits.size() ; h++ )
+        {
+            int j = patch_surf[ hits[h] ];
+            if ( j > i && check_pair[i][j] )
+            {
+                overlap[p].push_back( hits[h] );
+            }
+        }
+        sort( overlap[p].begin(), overlap[p].end() );
+    }, GetNumMeshThreads() );
 
-    double tol = 1e-10; // Tolerance buildup due to SurfPatch::find_closest_uw_planar_approx and other inaccuracies
+    //==== Work Items - One Patch Against The Overlapping Patches Of One Surface ====//
+    // Ordered by surface pair, then patch, as in a serial surface by surface loop,
+    // so segments are added in the same order for any number of threads.
+    vector< int > item_patch;
+    vector< int > item_begin;
+    vector< int > item_end;
+    vector< int > surf_items_left( nsurf, 0 );
 
-    if ( pA.get_u_min() > 0.0 ) // if Patch A is not the very beginning of u
+    int p = 0;
+    for ( int i = 0 ; i < nsurf ; i++ )
     {
-        double lim = pA.get_u_min() + tol;
-        // if both points projected to A are on the starting edge of u
-        if ( plane_uwA0.v[0] <= lim && plane_uwA1.v[0] <= lim )
+        vector< vector< int > > surf_items; // { surface j, patch, begin, end }
+        for ( ; p < npatch && patch_surf[p] == i ; p++ )
         {
-            return;
+            int h = 0;
+            while ( h < ( int )overlap[p].size() )
+            {
+                int j = patch_surf[ overlap[p][h] ];
+                int begin = h;
+                while ( h < ( int )overlap[p].size() && patch_surf[ overlap[p][h] ] == j )
+                {
+                    h++;
+                }
+                surf_items.push_back( { j, p, begin, h } );
+            }
         }
-    }
 
-    if ( pB.get_u_min() > 0.0 ) // if Patch B is not the very beginning of u
-    {
-        double lim = pB.get_u_min() + tol;
-        // if both points projected to B are on the starting edge of u
-        if ( plane_uwB0.v[0] <= lim && plane_uwB1.v[0] <= lim )
+        stable_sort( surf_items.begin(), surf_items.end(),
+                     []( const vector< int > & a, const vector< int > & b )
+                     {
+                         return a[0] < b[0];
+                     } );
+
+        for ( int k = 0 ; k < ( int )surf_items.size() ; k++ )
         {
-            return;
+            item_patch.push_back( surf_items[k][1] );
+            item_begin.push_back( surf_items[k][2] );
+            item_end.push_back( surf_items[k][3] );
         }
+        surf_items_left[i] = ( int )surf_items.size();
     }
+    int nitem = ( int )item_patch.size();
+
+    //==== Subdivide And Intersect Patch Pairs ====//
+    // Each item fills its own segment buffer, merged in item order below.
+    vector< vector< PatchISeg > > item_isegs( nitem );
 
-    if ( pA.get_w_min() > 0.0 ) // if Patch A is not the very beginning of w
+    int num_done = 0;
+    for ( int i = 0 ; i < nsurf ; i++ )
     {
-        double lim = pA.get_w_min() + tol;
-        // if both points projected to A are on the starting edge of w
-        if ( plane_uwA0.v[1] <= lim && plane_uwA1.v[1] <= lim )
+        if ( surf_items_left[i] == 0 )
         {
-            return;
+            num_done++;
         }
     }
-
-    if ( pB.get_w_min() > 0.0 ) // if Patch B is not the very beginning of w
+    std::mutex progress_mutex;
+    ParallelUtil::ParallelFor( nitem, [&]( int k )
     {
-        double lim = pB.get_w_min() + tol;
-        // if both points projected to B are on the starting edge of w
-        if ( plane_uwB0.v[1] <= lim && plane_uwB1.v[1] <= lim )
+        int p = item_patch[k];
+        for ( int h = item_begin[k] ; h < item_end[k] ; h++ )
         {
-            return;
+            intersect( *patch_vec[p], *patch_vec[ overlap[p][h] ], item_isegs[k] );
         }
-    }
-
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, plane_uwA0.v, proj_uwA0.v );
 
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, plane_uwB0.v, proj_uwB0.v );
-
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, plane_uwA1.v, proj_uwA1.v );
+        std::lock_guard< std::mutex > lock( progress_mutex );
+        int i = patch_surf[p];
+        surf_items_left[i]--;
+        if ( surf_items_left[i] == 0 )
+        {
+            char str[256];
+            num_done++;
+            sprintf( str, _("Intersect %d/%d\n"), num_done, nsurf );
+            addOutputText( str );
+        }
+    }, GetNumMeshThreads() );
 
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, plane_uwB1.v, proj_uwB1.v );
+    //==== Intersection Segments Get Loaded at AddIntersectionSeg ===//
+    for ( int k = 0 ; k < nitem ; k++ )
+    {
+        for ( int s = 0 ; s < ( int )item_isegs[k].size() ; s++ )
+        {
+            AddIntersectionSeg( item_isegs[k][s] );
+        }
+    }
+}
 
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+void SurfaceIntersectionSingleton::AddIntersectionSeg( const PatchISeg & iseg )
+{
+    Puw* puwA0 = new Puw( iseg.m_SurfA, iseg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( iseg.m_SurfB, iseg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = iseg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( iseg.m_SurfA, iseg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( iseg.m_SurfB, iseg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = iseg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
     // Identify rectangles to represent final patches
-    m_IPatchADrawLines.push_back( pA.GetPatchDrawLines() );
-    m_IPatchBDrawLines.push_back( pB.GetPatchDrawLines() );
+    m_IPatchADrawLines.push_back( iseg.m_PatchADrawLines );
+    m_IPatchBDrawLines.push_back( iseg.m_PatchBDrawLines );
 
-    new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    new ISeg( iseg.m_SurfA, iseg.m_SurfB, ipnt0, ipnt1 );
 
     m_AllIPnts.push_back( ipnt0 );
     m_AllIPnts.push_back( ipnt1 );
@@ -1864,11 +1940,11 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, cons
         onetime = false;
     }
 
-    double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
-    double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
+    double dA0 = dist( iseg.m_Pnt[0], puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
+    double dB0 = dist( iseg.m_Pnt[0], puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
-    double dA1 = dist( ip1, puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
-    double dB1 = dist( ip1, puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
+    double dA1 = dist( iseg.m_Pnt[1], puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
+    double dB1 = dist( iseg.m_Pnt[1], puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
 
     double total_d = dA0 + dB0 + dA1 + dB1;
 
@@ -1997,17 +2073,19 @@ void SurfaceIntersectionSingleton::BuildChains()
     // After the intersection chains are formed, refine them so that the value returned by CompPnt
     // will be the same with respect to each parent surface of the intersection point. Note, this 
     // must be done before the border curves are spit at each intersection chain end point.
-    list< ISegChain* >::iterator c;
-    for ( c = m_ISegChainList.begin(); c != m_ISegChainList.end(); ++c )
+    // Each chain only moves its own IPnts, so chains are refined in parallel.
+    vector< ISegChain* > chains( m_ISegChainList.begin(), m_ISegChainList.end() );
+
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
-        if ( ( *c )->m_SurfA == ( *c )->m_SurfB )
+        if ( chains[i]->m_SurfA == chains[i]->m_SurfB )
         {
             // Do not refine SubSurface curves
-            continue;
+            return;
         }
 
-        RefineISegChain( *c );
-    }
+        RefineISegChain( chains[i] );
+    }, GetNumMeshThreads() );
 }
 
 void SurfaceIntersectionSingleton::RefineISegChainSeg( ISegChain* c, IPnt* ipnt )
@@ -2679,17 +2757,23 @@ void SurfaceIntersectionSingleton::SplitBorderCurves()
     }
 
     //==== Split Chains ====//
-    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
         chains[i]->MergeSplits();
-        vector< ISegChain* > new_chains = chains[i]->SortAndSplit( this );
-        for ( int j = 0 ; j < ( int )new_chains.size() ; j++ )
+    }, GetNumMeshThreads() );
+
+    vector< vector< ISegChain* > > new_chains;
+    SortAndSplitChains( chains, new_chains );
+
+    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )new_chains[i].size() ; j++ )
         {
-            new_chains[j]->m_BorderFlag = true;
-            if ( new_chains[j]->Valid() )
+            new_chains[i][j]->m_BorderFlag = true;
+            if ( new_chains[i][j]->Valid() )
             {
-                new_chains[j]->m_SSIntersectIndex = chains[i]->m_SSIntersectIndex; // Track SubSurface Index
-                m_ISegChainList.push_back( new_chains[j] );
+                new_chains[i][j]->m_SSIntersectIndex = chains[i]->m_SSIntersectIndex; // Track SubSurface Index
+                m_ISegChainList.push_back( new_chains[i][j] );
             }
         }
     }
@@ -2765,55 +2849,82 @@ void SurfaceIntersectionSingleton::IntersectSplitChains()
     }
 
     //==== Build Bounding Boxes Around Intersection Curves ====//
-    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
         chains[i]->BuildBoxes();
-    }
+    }, GetNumMeshThreads() );
 
     //==== Do Intersection ====//
-    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    // Crossings are found in parallel, then added as splits in pair order.
+    vector< vector< ISegCross > > cross_vec( chains.size() );
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
         for ( int j = i + 1 ; j < ( int )chains.size() ; j++ )
         {
             if ( chains[i]->m_SurfA == chains[j]->m_SurfA || chains[i]->m_SurfA == chains[j]->m_SurfB )
             {
-                chains[i]->Intersect( chains[i]->m_SurfA, chains[j] );
+                chains[i]->FindCrossings( chains[i]->m_SurfA, chains[j], cross_vec[i] );
             }
             else if ( chains[i]->m_SurfB == chains[j]->m_SurfA || chains[i]->m_SurfB == chains[j]->m_SurfB )
             {
-                chains[i]->Intersect( chains[i]->m_SurfB, chains[j] );
+                chains[i]->FindCrossings( chains[i]->m_SurfB, chains[j], cross_vec[i] );
             }
         }
-    }
+    }, GetNumMeshThreads() );
 
-    //==== Merge Splits ====//
-    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    for ( int i = 0 ; i < ( int )cross_vec.size() ; i++ )
     {
-        chains[i]->MergeSplits();
+        for ( int k = 0 ; k < ( int )cross_vec[i].size() ; k++ )
+        {
+            ISegCross & cross = cross_vec[i][k];
+            cross.m_ChainA->AddSplit( cross.m_SurfA, cross.m_IndexA, cross.m_UW );
+            cross.m_ChainB->AddSplit( cross.m_SurfB, cross.m_IndexB, cross.m_UW );
+        }
     }
 
-    //==== Remove Chain End Splits ====//
-    for ( int i = 0 ; i < ( int )chains.size() ; i++ )
+    //==== Merge Splits, Remove Chain End Splits ====//
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
     {
+        chains[i]->MergeSplits();
         chains[i]->RemoveChainEndSplits();
-    }
+    }, GetNumMeshThreads() );
 
     //==== Split Chains ====//
+    vector< vector< ISegChain* > > new_chains;
+    SortAndSplitChains( chains, new_chains );
+
     for ( int i = 0 ; i < ( int )chains.size() ; i++ )
     {
-        vector< ISegChain* > new_chains = chains[i]->SortAndSplit( this );
-        for ( int j = 0 ; j < ( int )new_chains.size() ; j++ )
+        for ( int j = 0 ; j < ( int )new_chains[i].size() ; j++ )
         {
-            if ( new_chains[j]->Valid() )
+            if ( new_chains[i][j]->Valid() )
             {
-                new_chains[j]->m_SSIntersectIndex = chains[i]->m_SSIntersectIndex; // Track SubSurface Index
-                m_ISegChainList.push_back( new_chains[j] );
+                new_chains[i][j]->m_SSIntersectIndex = chains[i]->m_SSIntersectIndex; // Track SubSurface Index
+                m_ISegChainList.push_back( new_chains[i][j] );
             }
 
         }
     }
 }
 
+//==== Split Chains In Parallel, New Points Are Kept In Chain Order ====//
+void SurfaceIntersectionSingleton::SortAndSplitChains( const vector< ISegChain* > & chains, vector< vector< ISegChain* > > & new_chains )
+{
+    new_chains.clear();
+    new_chains.resize( chains.size() );
+    vector< IPntPool > pool_vec( chains.size() );
+
+    ParallelUtil::ParallelFor( ( int )chains.size(), [&]( int i )
+    {
+        new_chains[i] = chains[i]->SortAndSplit( &pool_vec[i] );
+    }, GetNumMeshThreads() );
+
+    for ( int i = 0 ; i < ( int )pool_vec.size() ; i++ )
+    {
+        AddDelPool( pool_vec[i] );
+    }
+}
+
 void SurfaceIntersectionSingleton::MergeInteriorChainIPnts()
 {
     //==== Merge Interior IPnts in Chains ====//
@@ -3166,38 +3277,36 @@ void SurfaceIntersectionSingleton::BinaryAdaptIntCurves()
     m_RawCurveBVec.clear();
     m_BorderCurveFlagVec.clear();
 
-    list<ISegChain *>::iterator c;
-    for ( c = m_ISegChainList.begin(); c != m_ISegChainList.end(); ++c )
-    {
-        m_BorderCurveFlagVec.push_back( (*c)->m_BorderFlag );
-
-        vector<vec3d> ptvec;
-        vector<vec3d> rawptvec;
-
-        Bezier_curve xyzcrvA = (*c)->m_ACurve.GetUWCrv();
-        xyzcrvA.TessAdaptXYZ( *(*c)->m_ACurve.GetSurf(), ptvec, GetSettingsPtr()->m_RelCurveTol, 16 );
+    vector< ISegChain* > chains( m_ISegChainList.begin(), m_ISegChainList.end() );
+    int nchain = ( int )chains.size();
 
-        m_BinAdaptCurveAVec.push_back( ptvec );
-
-        xyzcrvA.UWCurveToXYZCurve( (*c)->m_ACurve.GetSurf() );
-        xyzcrvA.GetControlPoints( rawptvec );
-
-        m_RawCurveAVec.push_back( rawptvec );
+    m_BinAdaptCurveAVec.resize( nchain );
+    m_BinAdaptCurveBVec.resize( nchain );
+    m_RawCurveAVec.resize( nchain );
+    m_RawCurveBVec.resize( nchain );
 
+    // vector< bool > packs bits, so the flags are not set from the threads.
+    for ( int i = 0 ; i < nchain ; i++ )
+    {
+        m_BorderCurveFlagVec.push_back( chains[i]->m_BorderFlag );
+    }
 
-        ptvec.clear();
-        rawptvec.clear();
-        Bezier_curve xyzcrvB = (*c)->m_BCurve.GetUWCrv();
-        xyzcrvB.TessAdaptXYZ( *(*c)->m_BCurve.GetSurf(), ptvec, GetSettingsPtr()->m_RelCurveTol, 16 );
+    ParallelUtil::ParallelFor( nchain, [&]( int i )
+    {
+        ISegChain* c = chains[i];
 
-        m_BinAdaptCurveBVec.push_back( ptvec );
+        Bezier_curve xyzcrvA = c->m_ACurve.GetUWCrv();
+        xyzcrvA.TessAdaptXYZ( *c->m_ACurve.GetSurf(), m_BinAdaptCurveAVec[i], GetSettingsPtr()->m_RelCurveTol, 16 );
 
-        xyzcrvB.UWCurveToXYZCurve( (*c)->m_BCurve.GetSurf() );
-        xyzcrvB.GetControlPoints( rawptvec );
+        xyzcrvA.UWCurveToXYZCurve( c->m_ACurve.GetSurf() );
+        xyzcrvA.GetControlPoints( m_RawCurveAVec[i] );
 
-        m_RawCurveBVec.push_back( rawptvec );
+        Bezier_curve xyzcrvB = c->m_BCurve.GetUWCrv();
+        xyzcrvB.TessAdaptXYZ( *c->m_BCurve.GetSurf(), m_BinAdaptCurveBVec[i], GetSettingsPtr()->m_RelCurveTol, 16 );
 
-    }
+        xyzcrvB.UWCurveToXYZCurve( c->m_BCurve.GetSurf() );
+        xyzcrvB.GetControlPoints( m_RawCurveBVec[i] );
+    }, GetNumMeshThreads() );
 }
 
 void SurfaceIntersectionSingleton::UpdateDrawObjs()
@@ -21,7 +21,8 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patches, keep splitting till planer, intersect.
+//      Surf::CheckIntersect - find surface pairs, SurfPatchBox - find overlapping patches.
+//      intersect - keep splitting patch pairs till planer, intersect.
 //          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
@@ -55,6 +56,7 @@
 //#endif
 
 #include "Surf.h"
+#include "IntersectPatch.h"
 #include "Mesh.h"
 #include "SCurve.h"
 #include "ICurve.h"
@@ -69,6 +71,7 @@
 #include "CADutil.h"
 #include "PntNodeMerge.h"
 #include "AnalysisMgr.h"
+#include "ParallelUtil.h"
 
 #include "Vec2d.h"
 #include "Vec3d.h"
@@ -123,6 +126,10 @@ public:
     void ClearWakes();
 
     void SetLeadingEdges( vector < piecewise_curve_type >& wake_leading_edges );
+    int GetNumLeadingEdges()
+    {
+        return m_LeadingEdgeVec.size();
+    }
     void CreateWakesAppendBorderCurves( vector< ICurve* >& border_curves, SimpleGridDensity* grid_density_ptr );
     vector< Surf* > GetWakeSurfs();
     void StretchWakes();
@@ -221,6 +228,13 @@ public:
 
     void addOutputText( string str, int output_type = VOCAL_OUTPUT );
 
+    // Threads for the per-surface meshing stages, 0 uses every hardware thread
+    int GetNumMeshThreads();
+    void SetNumMeshThreads( int num_threads )
+    {
+        m_NumMeshThreads = num_threads;
+    }
+
     virtual void UpdateDrawObjs();
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -252,9 +266,10 @@ public:
     enum { QUIET_OUTPUT, VOCAL_OUTPUT, };
 
     virtual void Intersect();
+    virtual void IntersectPatches();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
-    virtual void AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 );
+    virtual void AddIntersectionSeg( const PatchISeg & iseg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -268,6 +283,7 @@ public:
 
     virtual void BuildCurves();
     virtual void IntersectSplitChains();
+    virtual void SortAndSplitChains( const vector< ISegChain* > & chains, vector< vector< ISegChain* > > & new_chains );
 
     virtual void BinaryAdaptIntCurves();
 
@@ -291,6 +307,11 @@ public:
     {
         m_DelIPntVec.push_back( ip );
     }
+    virtual void AddDelPool( const IPntPool & pool )
+    {
+        m_DelPuwVec.insert( m_DelPuwVec.end(), pool.m_DelPuwVec.begin(), pool.m_DelPuwVec.end() );
+        m_DelIPntVec.insert( m_DelIPntVec.end(), pool.m_DelIPntVec.begin(), pool.m_DelIPntVec.end() );
+    }
 
     virtual void WriteChains();
 
@@ -413,8 +434,14 @@ protected:
 
     string m_WakeGeomID;
 
+    int m_NumMeshThreads;
+
 private:
 
+    // Serializes addOutputText when surfaces, or whole FEA structures, are
+    // meshed in parallel
+    static std::mutex m_OutputMutex;
+
     DrawObj m_IsectCurveDO;
     DrawObj m_IsectPtsDO;
     DrawObj m_BorderCurveDO;
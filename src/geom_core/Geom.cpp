@@ -110,6 +110,8 @@ GeomBase::GeomBase( Vehicle* vehicle_ptr )
     m_TessDirty = true;
     m_HighlightDirty = true;
     m_FeaDirty = true;
+
+    MarkChanged();
 }
 
 //==== Destructor ====//
@@ -118,6 +120,12 @@ GeomBase::~GeomBase()
 
 }
 
+void GeomBase::MarkChanged()
+{
+    static long long stamp = 0;
+    m_ChangeStamp = ++stamp;
+}
+
 // SetDirtyFlags is a bit of an abomination.
 // This implements the magic logic to allow more fine grained Geom::Update().  Essentially, it classifies each Parm
 // changed (called from ParmChanged) by the kind of effect it has.  For now, there are three groups:
@@ -232,6 +240,8 @@ void GeomBase::SetDirtyFlag( int dflag )
 //==== Parm Changed ====//
 void GeomBase::ParmChanged( Parm* parm_ptr, int type )
 {
+    MarkChanged();
+
     if ( parm_ptr )
     {
         m_UpdatedParmVec.push_back( parm_ptr->GetID() );
@@ -1124,6 +1134,11 @@ void Geom::Update( bool fullupdate )
 
     m_LateUpdateFlag = false;
 
+    if ( m_SurfDirty || m_XFormDirty || m_TessDirty )
+    {
+        MarkChanged();
+    }
+
     m_CappingDone = false;
 
     if ( m_SurfDirty )
@@ -4713,6 +4728,7 @@ void Geom::DelSubSurf( int ind )
     {
         delete m_SubSurfVec[ind];
         m_SubSurfVec.erase( m_SubSurfVec.begin() + ind );
+        MarkChanged();
     }
 
     SubSurfaceMgr.ReSuffixGroupNames( GetID() );
@@ -244,10 +244,20 @@ public:
 
     void SetDirtyFlag( int dflag );
 
+    // Stamp taken from a counter shared by all Geoms, renewed whenever this
+    // Geom may have changed.  Equal stamps mean an unchanged Geom.
+    long long GetChangeStamp() const
+    {
+        return m_ChangeStamp;
+    }
+    void MarkChanged();
+
 protected:
 
     void SetDirtyFlags( Parm* parm_ptr );
 
+    long long m_ChangeStamp;
+
     Vehicle* m_Vehicle;
 
     GeomType m_Type;
@@ -512,6 +522,7 @@ public:
     virtual void AddSubSurf( SubSurface* sub_surf )
     {
         m_SubSurfVec.push_back( sub_surf );
+        MarkChanged();
     }
     virtual SubSurface* AddSubSurf( int type, int surfindex );
     virtual bool ValidSubSurfInd( int ind );
@@ -400,6 +400,14 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos, const str
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+bool PointSimpleSource::GetCullBBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_Loc + vec3d( m_Rad, m_Rad, m_Rad ) );
+    box.Update( m_Loc - vec3d( m_Rad, m_Rad, m_Rad ) );
+    return true;
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     m_Loc = geomPtr->CompPnt01(m_SurfIndx, m_ULoc, m_WLoc);
@@ -506,6 +514,12 @@ void LineSimpleSource::AdjustLen( double val )
     m_Len2 = m_Len2 * val;
 }
 
+bool LineSimpleSource::GetCullBBox( BndBox & box )
+{
+    box = m_Box;
+    return true;
+}
+
 double LineSimpleSource::GetTargetLen( double base_len, vec3d & pos, const string & geomid, const int & surfindx, const double & u, const double &w )
 {
 
@@ -695,6 +709,14 @@ void BoxSimpleSource::SetMinMaxPnts( const vec3d & min_pnt, const vec3d & max_pn
     m_Box.Update( m_CullMaxPnt );
 }
 
+bool BoxSimpleSource::GetCullBBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_CullMinPnt );
+    box.Update( m_CullMaxPnt );
+    return true;
+}
+
 double BoxSimpleSource::GetTargetLen( double base_len, vec3d & pos, const string & geomid, const int & surfindx, const double & u, const double &w )
 {
     if ( pos[0] <= m_CullMinPnt[0] )
@@ -21,10 +21,87 @@
 
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "ParallelUtil.h"
 
 #include "SubSurfaceMgr.h"
 #include "VspUtil.h"
 
+//==== Trimmed Mesh Cache ====//
+TrimmedMeshCache::TrimmedMeshCache()
+{
+    m_DeleteOpen = false;
+    m_AnyOpen = false;
+}
+
+TrimmedMeshCache::~TrimmedMeshCache()
+{
+    Clear();
+}
+
+void TrimmedMeshCache::Clear()
+{
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        delete m_TMeshVec[i];
+    }
+    m_TMeshVec.clear();
+
+    for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        delete m_SubSurfVec[i];
+    }
+    m_SubSurfVec.clear();
+
+    m_Key.clear();
+    m_Info = MeshInfo();
+    m_TagCombos.clear();
+}
+
+void TrimmedMeshCache::CopyMeshVec( const vector< TMesh* > & from_vec, vector< TMesh* > & to_vec )
+{
+    for ( int i = 0 ; i < ( int )from_vec.size() ; i++ )
+    {
+        TMesh* tm = new TMesh();
+        tm->CopyTrimmed( from_vec[i] );
+        to_vec.push_back( tm );
+    }
+}
+
+bool TrimmedMeshCache::Load( const string & key, bool deleteopen, vector< TMesh* > & tmesh_vec, vector< TMesh* > & sub_surf_vec,
+                             MeshInfo & info, std::set< vector< int > > & tag_combos )
+{
+    if ( m_Key.empty() || key != m_Key )
+    {
+        return false;
+    }
+
+    if ( deleteopen != m_DeleteOpen && m_AnyOpen )
+    {
+        return false;
+    }
+
+    CopyMeshVec( m_TMeshVec, tmesh_vec );
+    CopyMeshVec( m_SubSurfVec, sub_surf_vec );
+    info = m_Info;
+    tag_combos = m_TagCombos;
+    return true;
+}
+
+void TrimmedMeshCache::Store( const string & key, bool deleteopen, bool anyopen, const vector< TMesh* > & tmesh_vec,
+                              const vector< TMesh* > & sub_surf_vec, const MeshInfo & info, const std::set< vector< int > > & tag_combos )
+{
+    Clear();
+
+    m_Key = key;
+    m_DeleteOpen = deleteopen;
+    m_AnyOpen = anyopen;
+
+    CopyMeshVec( tmesh_vec, m_TMeshVec );
+    CopyMeshVec( sub_surf_vec, m_SubSurfVec );
+    m_Info = info;
+    m_TagCombos = tag_combos;
+}
+
 //==== Constructor =====//
 MeshGeom::MeshGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
 {
@@ -469,17 +546,15 @@ void MeshGeom::WriteStl( FILE* file_id )
 void MeshGeom::WriteStl( FILE* file_id, int tag )
 {
     //==== Write Out Tris ====//
-    for ( int i = 0 ; i < ( int )m_IndexedTriVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumTris() ; i++ )
     {
-        TTri* ttri = m_IndexedTriVec[i];
-
-        int t = SubSurfaceMgr.GetTag( ttri->m_Tags );
+        int t = m_IndexedMesh.GetTag( i );
 
         if ( t == tag )
         {
-            vec3d p0 = ttri->m_N0->m_Pnt;
-            vec3d p1 = ttri->m_N1->m_Pnt;
-            vec3d p2 = ttri->m_N2->m_Pnt;
+            vec3d p0 = m_IndexedMesh.GetPnt( m_IndexedMesh.GetTriNode( i, 0 ) );
+            vec3d p1 = m_IndexedMesh.GetPnt( m_IndexedMesh.GetTriNode( i, 1 ) );
+            vec3d p2 = m_IndexedMesh.GetPnt( m_IndexedMesh.GetTriNode( i, 2 ) );
             vec3d v10 = p1 - p0;
             vec3d v20 = p2 - p1;
             vec3d norm = cross( v10, v20 );
@@ -620,7 +695,7 @@ int MeshGeom::ReadTriFile( const char * file_name )
     return 1;
 }
 
-void MeshGeom::InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset )
+void MeshGeom::InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset, vector < TTri* > &tri_vec )
 {
     //==== Find All Exterior and Split Tris =====//
     for ( int m = 0 ; m < meshvec.size() ; m++ )
@@ -637,7 +712,7 @@ void MeshGeom::InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset )
                         char str[80];
                         sprintf( str, "%d", offset );
                         tri->m_SplitVec[s]->m_ID = string( str );
-                        m_IndexedTriVec.push_back( tri->m_SplitVec[s] );
+                        tri_vec.push_back( tri->m_SplitVec[s] );
                     }
                 }
             }
@@ -646,7 +721,7 @@ void MeshGeom::InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset )
                 char str[80];
                 sprintf( str, "%d", offset );
                 tri->m_ID = string( str );
-                m_IndexedTriVec.push_back( tri );
+                tri_vec.push_back( tri );
             }
         }
         offset++;
@@ -656,91 +731,32 @@ void MeshGeom::InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset )
 //==== Build Indexed Mesh ====//
 void MeshGeom::BuildIndexedMesh( int partOffset )
 {
-    m_IndexedTriVec.clear();
-    m_IndexedNodeVec.clear();
+    m_IndexedMesh.Clear();
 
     partOffset++;
 
+    vector< TTri* > tri_vec;
     if ( m_ViewMeshFlag() )
     {
-        InitIndexedMesh( m_TMeshVec, partOffset );
+        InitIndexedMesh( m_TMeshVec, partOffset, tri_vec );
     }
 
     if ( m_ViewSliceFlag() )
     {
-        InitIndexedMesh( m_SliceVec, partOffset );
+        InitIndexedMesh( m_SliceVec, partOffset, tri_vec );
     }
 
-    //==== Collect All Points ====//
-    vector< TNode* > allNodeVec;
-    allNodeVec.reserve( m_IndexedTriVec.size() * 3 );
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        m_IndexedTriVec[t]->m_N0->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N0 );
-        m_IndexedTriVec[t]->m_N1->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N1 );
-        m_IndexedTriVec[t]->m_N2->m_ID = ( int )allNodeVec.size();
-        allNodeVec.push_back( m_IndexedTriVec[t]->m_N2 );
-    }
-    vector< vec3d > allPntVec( allNodeVec.size() );
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        allPntVec[i] = allNodeVec[i]->m_Pnt;
-    }
-
-    if ( allPntVec.size() == 0 )
+    if ( tri_vec.size() == 0 )
     {
         return;
     }
 
-    //==== Build Map ====//
-    PntNodeCloud pnCloud;
-    pnCloud.AddPntNodes( allPntVec );
-
     //==== Compute Tol ====//
     BndBox bb = m_Vehicle->GetBndBox();
     double tol = bb.GetLargestDist() * 1.0e-10;
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
-
-    //==== Load Used Nodes ====//
-    m_IndexedNodeVec.reserve( pnCloud.m_NumUsedPts );
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        if ( pnCloud.UsedNode( i ) )
-        {
-            m_IndexedNodeVec.push_back( allNodeVec[i] );
-        }
-    }
-
-    //==== Set Adjusted Node IDs ====//
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
-    {
-        allNodeVec[i]->m_ID = pnCloud.GetNodeUsedIndex( i );
-    }
-
-    //==== Remove Any Bogus Tris ====//
-    vector< TTri* > goodTriVec;
-    goodTriVec.reserve( m_IndexedTriVec.size() );
-    //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            if ( ttri->m_N0->m_ID != ttri->m_N1->m_ID &&
-                    ttri->m_N0->m_ID != ttri->m_N2->m_ID &&
-                    ttri->m_N1->m_ID != ttri->m_N2->m_ID )
-            {
-                goodTriVec.push_back( ttri );
-            }
-        }
-    }
-    // Swap instead of assign to avoid copy.
-    // m_IndexedTriVec = goodTriVec;
-    swap( m_IndexedTriVec, goodTriVec );
+    //==== Merge Close Points Into Compact Storage ====//
+    m_IndexedMesh.Build( tri_vec, tol );
 
     Update();
 }
@@ -750,15 +766,11 @@ void MeshGeom::WriteNascartPnts( FILE* fp )
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
     //==== Write Out Nodes ====//
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
-        }
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
+        fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
     }
 }
 
@@ -767,15 +779,11 @@ void MeshGeom::WriteCart3DPnts( FILE* fp )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
-        }
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
+        fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
     }
 }
 
@@ -784,15 +792,11 @@ void MeshGeom::WriteOBJPnts( FILE* fp )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "v %16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
-        }
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
+        fprintf( fp, "v %16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
     }
 }
 
@@ -801,11 +805,10 @@ void MeshGeom::WriteVSPGeomPnts( FILE* file_id )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        v = XFormMat.xform( tnode->m_Pnt );
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
         fprintf( file_id, "%16.10g %16.10g %16.10g\n", v.x(), v.y(), v.z() ); // , tnode->m_UWPnt.x(), tnode->m_UWPnt.y() );
     }
 }
@@ -814,18 +817,14 @@ int MeshGeom::WriteGMshNodes( FILE* fp, int node_offset )
 {
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + node_offset + 1,
-                     v.x(), v.y(), v.z() );
-        }
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
+        fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + node_offset + 1,
+                 v.x(), v.y(), v.z() );
     }
-    return node_offset + ( int )m_IndexedNodeVec.size();
+    return node_offset + m_IndexedMesh.NumNodes();
 }
 
 void MeshGeom::WriteFacetNodes( FILE* fp )
@@ -833,11 +832,10 @@ void MeshGeom::WriteFacetNodes( FILE* fp )
     //==== Write Out Nodes ====//
     vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0; i < (int)m_IndexedNodeVec.size(); i++ )
+    for ( int i = 0; i < m_IndexedMesh.NumNodes(); i++ )
     {
-        TNode* tnode = m_IndexedNodeVec[i];
         // Apply Transformations
-        v = XFormMat.xform( tnode->m_Pnt );
+        v = XFormMat.xform( m_IndexedMesh.GetPnt( i ) );
         fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(), v.z() );
     }
 }
@@ -845,74 +843,72 @@ void MeshGeom::WriteFacetNodes( FILE* fp )
 int MeshGeom::WriteNascartTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d %d.0\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N2->m_ID + 1 + off,
-                     ttri->m_N1->m_ID + 1 + off, SubSurfaceMgr.GetTag( ttri->m_Tags ) );
-        }
+        int n0 = m_IndexedMesh.GetTriNode( t, 0 );
+        int n1 = m_IndexedMesh.GetTriNode( t, 1 );
+        int n2 = m_IndexedMesh.GetTriNode( t, 2 );
+        fprintf( fp, "%d %d %d %d.0\n", n0 + 1 + off,  n2 + 1 + off,
+                 n1 + 1 + off, m_IndexedMesh.GetTag( t ) );
     }
 
-    return ( off + m_IndexedNodeVec.size() );
+    return ( off + m_IndexedMesh.NumNodes() );
 }
 
 int MeshGeom::WriteCart3DTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
-        }
+        int n0 = m_IndexedMesh.GetTriNode( t, 0 );
+        int n1 = m_IndexedMesh.GetTriNode( t, 1 );
+        int n2 = m_IndexedMesh.GetTriNode( t, 2 );
+        fprintf( fp, "%d %d %d\n", n0 + 1 + off,  n1 + 1 + off, n2 + 1 + off );
     }
 
-    return ( off + m_IndexedNodeVec.size() );
+    return ( off + m_IndexedMesh.NumNodes() );
 }
 
 int MeshGeom::WriteOBJTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "f %d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
-        }
+        int n0 = m_IndexedMesh.GetTriNode( t, 0 );
+        int n1 = m_IndexedMesh.GetTriNode( t, 1 );
+        int n2 = m_IndexedMesh.GetTriNode( t, 2 );
+        fprintf( fp, "f %d %d %d\n", n0 + 1 + off,  n1 + 1 + off, n2 + 1 + off );
     }
 
-    return ( off + m_IndexedNodeVec.size() );
+    return ( off + m_IndexedMesh.NumNodes() );
 }
 
 int MeshGeom::WriteVSPGeomTris( FILE* file_id, int offset )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        fprintf(file_id, "3 %d %d %d\n", ttri->m_N0->m_ID + 1 + offset, ttri->m_N1->m_ID + 1 + offset, ttri->m_N2->m_ID + 1 + offset );
+        int n0 = m_IndexedMesh.GetTriNode( t, 0 );
+        int n1 = m_IndexedMesh.GetTriNode( t, 1 );
+        int n2 = m_IndexedMesh.GetTriNode( t, 2 );
+        fprintf(file_id, "3 %d %d %d\n", n0 + 1 + offset, n1 + 1 + offset, n2 + 1 + offset );
     }
 
-    return ( offset + m_IndexedNodeVec.size() );
+    return ( offset + m_IndexedMesh.NumNodes() );
 }
 
 int MeshGeom::WriteGMshTris( FILE* fp, int node_offset, int tri_offset )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d 2 0 %d %d %d\n", t + tri_offset + 1,
-                     ttri->m_N0->m_ID + 1 + node_offset,  ttri->m_N2->m_ID + 1 + node_offset, ttri->m_N1->m_ID + 1 + node_offset );
-        }
+        int n0 = m_IndexedMesh.GetTriNode( t, 0 );
+        int n1 = m_IndexedMesh.GetTriNode( t, 1 );
+        int n2 = m_IndexedMesh.GetTriNode( t, 2 );
+        fprintf( fp, "%d 2 0 %d %d %d\n", t + tri_offset + 1,
+                 n0 + 1 + node_offset,  n2 + 1 + node_offset, n1 + 1 + node_offset );
     }
-    return ( tri_offset + m_IndexedTriVec.size() );
+    return ( tri_offset + m_IndexedMesh.NumTris() );
 }
 
 void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &part_count )
@@ -936,9 +932,9 @@ void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &p
     {
         int tag_count = 0;
 
-        for ( unsigned int j = 0; j < m_IndexedTriVec.size(); j++ )
+        for ( unsigned int j = 0; j < m_IndexedMesh.NumTris(); j++ )
         {
-            if ( all_tag_vec[i] == SubSurfaceMgr.GetTag( m_IndexedTriVec[j]->m_Tags ) )
+            if ( all_tag_vec[i] == m_IndexedMesh.GetTag( j ) )
             {
                 tag_count++;
             }
@@ -967,31 +963,33 @@ void MeshGeom::WriteFacetTriParts( FILE* fp, int &offset, int &tri_count, int &p
         int curr_tag = all_tag_vec[i];
         bool new_section = true; // flag to write small part section header
 
-        for ( unsigned int j = 0; j < m_IndexedTriVec.size(); j++ )
+        for ( unsigned int j = 0; j < m_IndexedMesh.NumTris(); j++ )
         {
-            if ( curr_tag == SubSurfaceMgr.GetTag( m_IndexedTriVec[j]->m_Tags ) ) // only write out current tris for surrent tag
+            if ( curr_tag == m_IndexedMesh.GetTag( j ) ) // only write out current tris for surrent tag
             {
                 if ( new_section ) // write small part header and get material ID for small part
                 {
-                    string name = SubSurfaceMgr.GetTagNames( m_IndexedTriVec[j]->m_Tags );
+                    string name = m_IndexedMesh.GetTagNames( j );
                     fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
                     fprintf( fp, "%d 3\n", tri_offset[i] ); // Number of facets for the part, 3 nodes per facet
 
                     new_section = false;
                 }
 
-                TTri* ttri = m_IndexedTriVec[j];
+                int n0 = m_IndexedMesh.GetTriNode( j, 0 );
+                int n1 = m_IndexedMesh.GetTriNode( j, 1 );
+                int n2 = m_IndexedMesh.GetTriNode( j, 2 );
 
                 tri_count++; // counter for number of tris/facets
 
                 // 3 nodes of facet, material ID, component ID, running facet #:
-                fprintf( fp, "%d %d %d %d %u %d\n", ttri->m_N0->m_ID + 1 + offset, ttri->m_N1->m_ID + 1 + offset, ttri->m_N2->m_ID + 1 + offset, materialID, i + 1 + part_count, tri_count );
+                fprintf( fp, "%d %d %d %d %u %d\n", n0 + 1 + offset, n1 + 1 + offset, n2 + 1 + offset, materialID, i + 1 + part_count, tri_count );
             }
         }
     }
 
     part_count += tri_offset.size();
-    offset += m_IndexedNodeVec.size();
+    offset += m_IndexedMesh.NumNodes();
 }
 
 int MeshGeom::WriteNascartParts( FILE* fp, int off )
@@ -1008,9 +1006,9 @@ int MeshGeom::WriteCart3DParts( FILE* fp  )
 {
     //==== Write Component IDs for each Tri =====//
     int tag;
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        tag = SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags );
+        tag = m_IndexedMesh.GetTag( t );
 
         fprintf( fp, "%d \n",  tag );
     }
@@ -1021,15 +1019,17 @@ int MeshGeom::WriteVSPGeomParts( FILE* file_id  )
 {
     //==== Write Component IDs for each Tri =====//
     int tag;
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
     {
-        TTri* ttri = m_IndexedTriVec[t];
-        tag = SubSurfaceMgr.GetTag( ttri->m_Tags );
+        tag = m_IndexedMesh.GetTag( t );
+        vec3d uw0 = m_IndexedMesh.GetUW( t, 0 );
+        vec3d uw1 = m_IndexedMesh.GetUW( t, 1 );
+        vec3d uw2 = m_IndexedMesh.GetUW( t, 2 );
 
         fprintf( file_id, "%d %16.10g %16.10g %16.10g %16.10g %16.10g %16.10g\n", tag,
-                 ttri->m_N0->m_UWPnt.x(), ttri->m_N0->m_UWPnt.y(),
-                 ttri->m_N1->m_UWPnt.x(), ttri->m_N1->m_UWPnt.y(),
-                 ttri->m_N2->m_UWPnt.x(), ttri->m_N2->m_UWPnt.y() );
+                 uw0.x(), uw0.y(),
+                 uw1.x(), uw1.y(),
+                 uw2.x(), uw2.y() );
     }
     return 0;
 }
@@ -1092,31 +1092,33 @@ bool AboutEqualWakeEdges ( const TEdge &a, const TEdge &b )
 
 int MeshGeom::WriteVSPGeomWakes( FILE* file_id, int offset )
 {
+    vector < int > waketris;
+    for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
+    {
+        if ( m_IndexedMesh.GetWakeEdge( t ) > 0 )
+        {
+            waketris.push_back( t );
+        }
+    }
+
+    //==== Stand In Nodes For The Wake Edge Ends Only ====//
+    vector < TNode > wakenodes( 2 * waketris.size() );
     vector < TEdge > wakeedges;
 
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+    for ( int w = 0 ; w < ( int )waketris.size() ; w++ )
     {
-        TTri *ttri = m_IndexedTriVec[t];
-        int we = ttri->WakeEdge();
+        int t = waketris[w];
+        int we = m_IndexedMesh.GetWakeEdge( t );
 
-        if ( we > 0 )
-        {
-            TEdge e;
-            if ( we == 1 )
-            {
-                e = TEdge( ttri->m_N0, ttri->m_N1, ttri );
-            }
-            else if ( we == 2 )
-            {
-                e = TEdge( ttri->m_N1, ttri->m_N2, ttri );
-            }
-            else
-            {
-                e = TEdge( ttri->m_N2, ttri->m_N0, ttri );
-            }
-            e.SortNodesByU();
-            wakeedges.push_back( e );
-        }
+        // Edge 1 is N0-N1, 2 is N1-N2 and 3 is N2-N0.
+        TNode* n0 = &wakenodes[ 2 * w ];
+        TNode* n1 = &wakenodes[ 2 * w + 1 ];
+        m_IndexedMesh.LoadTNode( t, we - 1, *n0 );
+        m_IndexedMesh.LoadTNode( t, we % 3, *n1 );
+
+        TEdge e( n0, n1, NULL );
+        e.SortNodesByU();
+        wakeedges.push_back( e );
     }
 
     sort( wakeedges.begin(), wakeedges.end(), OrderWakeEdges );
@@ -1194,7 +1196,7 @@ int MeshGeom::WriteVSPGeomWakes( FILE* file_id, int offset )
         m_PolyVec[iwake][iwe] = wakes[iwake][iwe - 1].m_N1->m_Pnt;
     }
 
-    return ( offset + m_IndexedNodeVec.size() );
+    return ( offset + m_IndexedMesh.NumNodes() );
 }
 
 void MeshGeom::WritePovRay( FILE* fid, int comp_num )
@@ -1618,27 +1620,24 @@ void MeshGeom::CreateGeomResults( Results* res )
         vector< vec3d > pvec;
         Matrix4d XFormMat = GetTotalTransMat();
         //==== Write Out Nodes ====//
-        for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
+        for ( int i = 0 ; i < m_IndexedMesh.NumNodes() ; i++ )
         {
-            TNode* tnode = m_IndexedNodeVec[i];
-            pvec.push_back( XFormMat.xform( tnode->m_Pnt ) );
+            pvec.push_back( XFormMat.xform( m_IndexedMesh.GetPnt( i ) ) );
         }
-        res->Add( NameValData( "Num_Pnts", ( int )m_IndexedNodeVec.size() ) );
+        res->Add( NameValData( "Num_Pnts", m_IndexedMesh.NumNodes() ) );
         res->Add( NameValData( "Tri_Pnts", pvec ) );
 
         //==== Write Out Tris ====//
         vector< int > id0_vec;
         vector< int > id1_vec;
         vector< int > id2_vec;
-        for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
+        for ( int t = 0 ; t < m_IndexedMesh.NumTris() ; t++ )
         {
-            TTri* ttri = m_IndexedTriVec[t];
-
-            id0_vec.push_back( ttri->m_N0->m_ID );
-            id1_vec.push_back( ttri->m_N1->m_ID );
-            id2_vec.push_back( ttri->m_N2->m_ID );
+            id0_vec.push_back( m_IndexedMesh.GetTriNode( t, 0 ) );
+            id1_vec.push_back( m_IndexedMesh.GetTriNode( t, 1 ) );
+            id2_vec.push_back( m_IndexedMesh.GetTriNode( t, 2 ) );
         }
-        res->Add( NameValData( "Num_Tris", ( int )m_IndexedTriVec.size() ) );
+        res->Add( NameValData( "Num_Tris", m_IndexedMesh.NumTris() ) );
         res->Add( NameValData( "Tri_Index0", id0_vec ) );
         res->Add( NameValData( "Tri_Index1", id1_vec ) );
         res->Add( NameValData( "Tri_Index2", id2_vec ) );
@@ -1672,8 +1671,7 @@ void MeshGeom::CreateGeomResults( Results* res )
 void MeshGeom::CreatePtCloudGeom()
 {
     BuildIndexedMesh( 0 );
-    vector < TNode* > nvec = m_IndexedNodeVec;
-    unsigned int npts = nvec.size();
+    unsigned int npts = m_IndexedMesh.NumNodes();
 
     if ( npts > 0 )
     {
@@ -1695,7 +1693,7 @@ void MeshGeom::CreatePtCloudGeom()
 
             for ( int j = 0; j < npts; j++ )
             {
-                new_geom->m_Pts[j] = XFormMat.xform( nvec[j]->m_Pnt );
+                new_geom->m_Pts[j] = XFormMat.xform( m_IndexedMesh.GetPnt( j ) );
             }
 
             new_geom->InitPts();
@@ -1874,126 +1872,7 @@ void MeshGeom::IntersectTrim( vector< DegenGeom > &degenGeom, bool degen, int in
         res->Add( NameValData( "Mesh_GeomID", this->GetID() ) );
     }
 
-    //==== Scale To 10 Units ====//
-    UpdateBBox();
-    m_LastScale = 1.0;
-    m_Scale = 1000.0 / m_BBox.GetLargestDist();
-    ApplyScale();
-
-    if ( !degen )
-    {
-        //==== Intersect Subsurfaces to make clean lines ====//
-        if ( intSubsFlag )
-        {
-            for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-            {
-                vector< TMesh* > sub_surf_meshes;
-                vector< SubSurface* > sub_surf_vec = SubSurfaceMgr.GetSubSurfs( m_TMeshVec[i]->m_PtrID, m_TMeshVec[i]->m_SurfNum );
-                int ss;
-                for ( ss = 0 ; ss < ( int )sub_surf_vec.size() ; ss++ )
-                {
-                    vector< TMesh* > tmp_vec = sub_surf_vec[ss]->CreateTMeshVec();
-                    sub_surf_meshes.insert( sub_surf_meshes.end(), tmp_vec.begin(), tmp_vec.end() );
-                }
-                m_SubSurfVec.insert( m_SubSurfVec.end(), sub_surf_meshes.begin(), sub_surf_meshes.end() );
-
-                if ( !sub_surf_meshes.size() )
-                {
-                    continue;    // Skip if no sub surface meshes
-                }
-
-                // Load All surf_mesh_bboxes
-                for ( ss = 0 ; ss < ( int )sub_surf_meshes.size() ; ss++ )
-                {
-                    // Build merge maps
-                    m_TMeshVec[i]->BuildMergeMaps();
-
-                    sub_surf_meshes[ss]->LoadBndBox();
-                    // Swap the m_TMeshVec[i]'s nodes to be UW instead of xyz
-                    m_TMeshVec[i]->MakeNodePntUW();
-                    m_TMeshVec[i]->LoadBndBox();
-
-                    // Intersect TMesh with sub_surface_meshes
-                    m_TMeshVec[i]->Intersect( sub_surf_meshes[ss], true );
-
-                    // Split the triangles
-                    m_TMeshVec[i]->Split();
-
-                    // Make current TMesh XYZ again and reset its octtree
-                    m_TMeshVec[i]->MakeNodePntXYZ();
-                    m_TMeshVec[i]->m_TBox.Reset();
-
-                    // Flatten Mesh
-                    TMesh* f_tmesh = new TMesh();
-                    f_tmesh->CopyFlatten( m_TMeshVec[i] );
-                    delete m_TMeshVec[i];
-                    m_TMeshVec[i] = f_tmesh;
-                }
-
-                sub_surf_meshes.clear();
-            }
-        }
-        // Tag meshes before regular intersection
-        SubTagTris( (bool)intSubsFlag );
-
-        MergeRemoveOpenMeshes( &info, deleteopen );
-    }
-
-    //==== Create Bnd Box for  Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->LoadBndBox();
-    }
-
-    //==== Update Bnd Box for  Combined ====//
-    BndBox b;
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
-    }
-    m_BBox = b;
-    //update_xformed_bbox();          // Load Xform BBox
-
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
-
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( m_TMeshVec.size() );
-    vector < bool > thicksurf( m_TMeshVec.size() );
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
-        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
-    }
-
-    //==== Mark which triangles to ignore ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-    }
-
-    //===== Reset Scale =====//
-    m_Scale = 1;
-    ApplyScale();
-    UpdateBBox();
+    TrimTMeshVec( info, degen, intSubsFlag, deleteopen );
 
     //==== Compute Areas ====//
     m_TotalTheoArea = m_TotalWetArea = 0.0;
@@ -2198,6 +2077,202 @@ void MeshGeom::IntersectTrim( vector< DegenGeom > &degenGeom, bool degen, int in
     }
 }
 
+//==== Merge Open Meshes, Then Intersect, Split and Trim m_TMeshVec ====//
+// Split tris inside other meshes are flagged to be ignored.  When an earlier
+// call left the same meshes in the Vehicle's TrimmedMeshCache they are copied
+// back in instead.  Open meshes are merged here unless degen, where the
+// caller has done so.
+void MeshGeom::TrimTMeshVec( MeshInfo & info, bool degen, int intSubsFlag, bool deleteopen )
+{
+    int i;
+
+    //==== Sub Surfaces Only Change The Meshes If Any Are Present ====//
+    bool subs = false;
+    if ( intSubsFlag && !degen )
+    {
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            if ( SubSurfaceMgr.GetSubSurfs( m_TMeshVec[i]->m_PtrID, m_TMeshVec[i]->m_SurfNum ).size() )
+            {
+                subs = true;
+            }
+        }
+    }
+
+    TrimmedMeshCache* cache = m_Vehicle->GetTrimmedMeshCache();
+    string key;
+    if ( !degen && !m_TrimCacheKey.empty() )
+    {
+        key = m_TrimCacheKey + ( subs ? ";SUBS" : "" );
+    }
+    m_TrimCacheKey.clear();
+
+    std::set< vector< int > > tag_combos;
+    bool anyopen = false;
+
+    vector< TMesh* > cached_vec;
+    if ( !key.empty() && cache->Load( key, deleteopen, cached_vec, m_SubSurfVec, info, tag_combos ) )
+    {
+        //==== Tag Maps As SubTagTris Left Them Before Merging ====//
+        SubSurfaceMgr.ClearTagMaps();
+        SubSurfaceMgr.m_CompNames = GetTMeshNames();
+        SubSurfaceMgr.m_CompIDs = GetTMeshIDs();
+        SubSurfaceMgr.SetSubSurfTags( GetNumIndexedParts() );
+        SubSurfaceMgr.BuildCompNameMap();
+        SubSurfaceMgr.BuildCompIDMap();
+        SubSurfaceMgr.m_TagCombos = tag_combos;
+        SubSurfaceMgr.BuildSingleTagMap();
+
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            delete m_TMeshVec[i];
+        }
+        m_TMeshVec = cached_vec;
+
+        m_LastScale = 1.0;
+        m_Scale = 1.0;
+        UpdateBBox();
+        return;
+    }
+
+    //==== Scale To 10 Units ====//
+    UpdateBBox();
+    m_LastScale = 1.0;
+    m_Scale = 1000.0 / m_BBox.GetLargestDist();
+    ApplyScale();
+
+    if ( !degen )
+    {
+        //==== Intersect Subsurfaces to make clean lines ====//
+        if ( subs )
+        {
+            for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+            {
+                vector< TMesh* > sub_surf_meshes;
+                vector< SubSurface* > sub_surf_vec = SubSurfaceMgr.GetSubSurfs( m_TMeshVec[i]->m_PtrID, m_TMeshVec[i]->m_SurfNum );
+                int ss;
+                for ( ss = 0 ; ss < ( int )sub_surf_vec.size() ; ss++ )
+                {
+                    vector< TMesh* > tmp_vec = sub_surf_vec[ss]->CreateTMeshVec();
+                    sub_surf_meshes.insert( sub_surf_meshes.end(), tmp_vec.begin(), tmp_vec.end() );
+                }
+                m_SubSurfVec.insert( m_SubSurfVec.end(), sub_surf_meshes.begin(), sub_surf_meshes.end() );
+
+                if ( !sub_surf_meshes.size() )
+                {
+                    continue;    // Skip if no sub surface meshes
+                }
+
+                // Load All surf_mesh_bboxes
+                for ( ss = 0 ; ss < ( int )sub_surf_meshes.size() ; ss++ )
+                {
+                    // Build merge maps
+                    m_TMeshVec[i]->BuildMergeMaps();
+
+                    sub_surf_meshes[ss]->LoadBndBox();
+                    // Swap the m_TMeshVec[i]'s nodes to be UW instead of xyz
+                    m_TMeshVec[i]->MakeNodePntUW();
+                    m_TMeshVec[i]->LoadBndBox();
+
+                    // Intersect TMesh with sub_surface_meshes
+                    m_TMeshVec[i]->Intersect( sub_surf_meshes[ss], true );
+
+                    // Split the triangles
+                    m_TMeshVec[i]->Split();
+
+                    // Make current TMesh XYZ again and reset its octtree
+                    m_TMeshVec[i]->MakeNodePntXYZ();
+                    m_TMeshVec[i]->m_TBox.Reset();
+
+                    // Flatten Mesh
+                    TMesh* f_tmesh = new TMesh();
+                    f_tmesh->CopyFlatten( m_TMeshVec[i] );
+                    delete m_TMeshVec[i];
+                    m_TMeshVec[i] = f_tmesh;
+                }
+
+                sub_surf_meshes.clear();
+            }
+        }
+        // Tag meshes before regular intersection
+        SubTagTris( subs );
+        tag_combos = SubSurfaceMgr.m_TagCombos;
+
+        int ndeleted = info.m_NumOpenMeshedDeleted;
+        MergeRemoveOpenMeshes( &info, deleteopen );
+
+        anyopen = ( info.m_NumOpenMeshedDeleted > ndeleted );
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            if ( m_TMeshVec[i]->m_NonClosedTriVec.size() )
+            {
+                anyopen = true;
+            }
+        }
+    }
+
+    //==== Create Bnd Box for  Mesh Geoms ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->LoadBndBox();
+    }
+
+    //==== Update Bnd Box for  Combined ====//
+    BndBox b;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+    }
+    m_BBox = b;
+    //update_xformed_bbox();          // Load Xform BBox
+
+    //==== Intersect All Mesh Geoms ====//
+    IntersectTMeshVec( m_TMeshVec );
+
+    //==== Split Intersected Tri in Mesh ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->Split();
+    }
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+    }
+
+    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
+    vector < int > bTypes( m_TMeshVec.size() );
+    vector < bool > thicksurf( m_TMeshVec.size() );
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
+        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
+    }
+
+    //==== Mark which triangles to ignore ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
+    }
+
+    //===== Reset Scale =====//
+    m_Scale = 1;
+    ApplyScale();
+    UpdateBBox();
+
+    //==== Boxes Were Loaded At The Trim Scale ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->m_TBox.Reset();
+    }
+
+    if ( !key.empty() )
+    {
+        cache->Store( key, deleteopen, anyopen, m_TMeshVec, m_SubSurfVec, info, tag_combos );
+    }
+}
+
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                           bool autoBounds, double start, double end )
@@ -2383,39 +2458,8 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         }
     }
 
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( m_TMeshVec.size() );
-    vector < bool > thicksurf( m_TMeshVec.size() );
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
-        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
-    }
-
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            m_TMeshVec[i]->RemoveIsectEdges();
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SliceTMeshVec( m_SliceVec, m_TMeshVec );
 
     TransMat.affineInverse();
 
@@ -2747,9 +2791,20 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         delete ss_tube_meshes[i];
     }
 
-    // Merge and remove any remaining open meshes
     MeshInfo info;
-    MergeRemoveOpenMeshes( &info );
+    if ( Flow_vec.empty() )
+    {
+        //==== Meshes Are As Tessellated, Trim Them Like CompGeom and MassProp ====//
+        TrimTMeshVec( info, false, 0, true );
+
+        // Trimming tags components only, restore the sub surface tags.
+        SubTagTris( true );
+    }
+    else
+    {
+        // Merge and remove any remaining open meshes
+        MergeRemoveOpenMeshes( &info );
+    }
 
     //==== Create Bnd Box for Mesh Geoms ====//
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2764,21 +2819,18 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         m_BBox.Update( m_TMeshVec[i]->m_TBox.m_Box );
     }
 
-    //==== Intersect All Mesh Geoms (before slicing) ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    if ( !Flow_vec.empty() )
     {
-        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        //==== Intersect All Mesh Geoms (before slicing) ====//
+        IntersectTMeshVec( m_TMeshVec );
+
+        //==== Split Intersected Tri in Mesh ====//
+        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            m_TMeshVec[i]->Split();
         }
     }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
     WaveDragMgr.m_XNorm.resize( numSlices );
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
@@ -2886,38 +2938,8 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
     }
 
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( m_TMeshVec.size() );
-    vector < bool > thicksurf( m_TMeshVec.size() );
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
-        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
-    }
-
-    //==== Load Bnding Box ====//
-    for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
-    {
-        TMesh* tm = m_SliceVec[islice];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            m_TMeshVec[i]->RemoveIsectEdges();
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangles Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SliceTMeshVec( m_SliceVec, m_TMeshVec );
 
     //==== Pushback slice and area results ====//
     // Make ID lookup map.
@@ -2959,9 +2981,9 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
 {
     int i, j, s;
 
-    //==== Check For Open Meshes and Merge or Delete Them ====//
+    //==== Merge or Delete Open Meshes, Then Intersect and Trim Them ====//
     MeshInfo info;
-    MergeRemoveOpenMeshes( &info );
+    TrimTMeshVec( info, false, 0, true );
 
     //==== Create Results ====//
     Results* res = ResultsMgr.CreateResults( "Mass_Properties" );
@@ -3045,66 +3067,8 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         }
     }
 
-    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
-    vector < int > bTypes( m_TMeshVec.size() );
-    vector < bool > thicksurf( m_TMeshVec.size() );
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        bTypes[i] = m_TMeshVec[i]->m_SurfCfdType;
-        thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
-    }
-
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            m_TMeshVec[i]->RemoveIsectEdges();
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-
-    }
-
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
-
-    //==== Mark which triangles to ignore ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SliceTMeshVec( m_SliceVec, m_TMeshVec );
 
     //==== Do Shell Calcs ====//
     vector< TriShellMassProp* > triShellVec;
@@ -3140,32 +3104,39 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         }
     }
 
-    //==== Build Tetrahedrons ====//
+    //==== Build Tetrahedrons, One Batch Per Slice ====//
+    // Batches are joined in slice order so the sums below match a serial build.
     double prismLength = sliceW;
-    vector< TetraMassProp* > tetraVec;
+    vector< vector< TetraMassProp* > > sliceTetraVec( m_SliceVec.size() );
 
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    ParallelUtil::ParallelFor( ( int )m_SliceVec.size(), [&]( int is )
     {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        TMesh* tm = m_SliceVec[is];
+        for ( int it = 0 ; it < ( int )tm->m_TVec.size() ; it++ )
         {
-            TTri* tri = tm->m_TVec[i];
+            TTri* tri = tm->m_TVec[it];
 
             if ( tri->m_SplitVec.size() )
             {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                for ( int js = 0 ; js < ( int )tri->m_SplitVec.size() ; js++ )
                 {
-                    if ( !tri->m_SplitVec[j]->m_IgnoreTriFlag )
+                    if ( !tri->m_SplitVec[js]->m_IgnoreTriFlag )
                     {
-                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
+                        CreatePrism( sliceTetraVec[is], tri->m_SplitVec[js], prismLength );
                     }
                 }
             }
             else if ( !tri->m_IgnoreTriFlag )
             {
-                CreatePrism( tetraVec, tri, prismLength );
+                CreatePrism( sliceTetraVec[is], tri, prismLength );
             }
         }
+    } );
+
+    vector< TetraMassProp* > tetraVec;
+    for ( s = 0 ; s < ( int )sliceTetraVec.size() ; s++ )
+    {
+        tetraVec.insert( tetraVec.end(), sliceTetraVec[s].begin(), sliceTetraVec[s].end() );
     }
 
     //==== Add in Point Masses ====//
@@ -3508,40 +3479,12 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         thicksurf[i] = m_TMeshVec[i]->m_ThickSurf;
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            m_TMeshVec[i]->RemoveIsectEdges();
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Mark which triangles to ignore ====//
-        tm->SetIgnoreTriFlag( m_TMeshVec, bTypes, thicksurf );
-
-    }
+    //==== Intersect, Split and Classify Slices ====//
+    SliceTMeshVec( m_SliceVec, m_TMeshVec );
 
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshVec( m_TMeshVec );
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -4017,6 +3960,11 @@ void MeshGeom::AddHalfBox( string id )
 
     m_TMeshVec.push_back( tm );
 
+    if ( !m_TrimCacheKey.empty() )
+    {
+        m_TrimCacheKey += ";HALF" + id;
+    }
+
     double xmin = box.GetMin( 0 );
     double xmax = box.GetMax( 0 );
 
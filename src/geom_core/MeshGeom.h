@@ -41,14 +41,47 @@ public:
     vector < string > m_DeletedMeshes;
 };
 
+//==== Trimmed Mesh Sets Kept Between Analyses ====//
+// Holds copies of the meshes MeshGeom::TrimTMeshVec leaves behind, under a key
+// naming the Geoms that made them, their change stamps and the trim options.
+// CompGeom, MassProp and WaveDrag of an unchanged set copy these back in
+// instead of intersecting again.  Only the latest set is kept.
+class TrimmedMeshCache
+{
+public:
+    TrimmedMeshCache();
+    virtual ~TrimmedMeshCache();
+
+    void Clear();
+
+    // Results with and without open meshes deleted only differ if some mesh
+    // stayed open, so either one may answer when none did.
+    bool Load( const string & key, bool deleteopen, vector< TMesh* > & tmesh_vec, vector< TMesh* > & sub_surf_vec,
+               MeshInfo & info, std::set< vector< int > > & tag_combos );
+    void Store( const string & key, bool deleteopen, bool anyopen, const vector< TMesh* > & tmesh_vec,
+                const vector< TMesh* > & sub_surf_vec, const MeshInfo & info, const std::set< vector< int > > & tag_combos );
+
+protected:
+
+    static void CopyMeshVec( const vector< TMesh* > & from_vec, vector< TMesh* > & to_vec );
+
+    string m_Key;
+    bool m_DeleteOpen;
+    bool m_AnyOpen;
+
+    vector< TMesh* > m_TMeshVec;
+    vector< TMesh* > m_SubSurfVec;
+    MeshInfo m_Info;
+    std::set< vector< int > > m_TagCombos;
+};
+
 
 class MeshGeom : public Geom
 {
 private:
     int m_BigEndianFlag;
 
-    vector< TTri* > m_IndexedTriVec;
-    vector< TNode* > m_IndexedNodeVec;
+    TIndexedMesh m_IndexedMesh;
 
     vector< TMesh* > m_SliceVec;
 
@@ -107,15 +140,15 @@ public:
     virtual void WriteStl( FILE* pov_file );
     virtual void WriteStl( FILE* stl_file, int tag );
 
-    virtual void InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset );
+    virtual void InitIndexedMesh( const vector < TMesh* > &meshvec, int & offset, vector < TTri* > &tri_vec );
     virtual void BuildIndexedMesh( int partOffset );
     virtual int  GetNumIndexedPnts() const
     {
-        return m_IndexedNodeVec.size();
+        return m_IndexedMesh.NumNodes();
     }
     virtual int  GetNumIndexedTris() const
     {
-        return m_IndexedTriVec.size();
+        return m_IndexedMesh.NumTris();
     }
     virtual int  GetNumIndexedParts() const
     {
@@ -148,6 +181,11 @@ public:
 
     //==== Intersection, Splitting and Trimming ====//
     virtual void IntersectTrim( vector< DegenGeom > &degenGeom, bool degen = true, int intSubsFlag = 1 );
+    virtual void TrimTMeshVec( MeshInfo & info, bool degen, int intSubsFlag, bool deleteopen );
+
+    // Names the meshes in m_TMeshVec for the TrimmedMeshCache.  Set by
+    // Vehicle::AddMeshGeom, extended by AddHalfBox and cleared once used.
+    string m_TrimCacheKey;
 
     virtual void MassSliceX( int numSlice, bool writefile = true );
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
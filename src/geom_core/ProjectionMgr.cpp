@@ -11,6 +11,7 @@
 #include "ParmMgr.h"
 #include "Vehicle.h"
 #include "MeshGeom.h"
+#include "ParallelUtil.h"
 
 #include "triangle.h"
 #include "triangle_api.h"
@@ -898,9 +899,6 @@ void ProjectionMgrSingleton::Triangulate()
     triangleio in, out;
     int tristatus = TRI_NULL;
 
-    // init
-    ctx = triangle_context_create();
-
     memset( &in, 0, sizeof( in ) ); // Load Zeros
     memset( &out, 0, sizeof( out ) );
 
@@ -959,13 +957,21 @@ void ProjectionMgrSingleton::Triangulate()
 
     char cmdline[] = "zpQ";
 
-    //==== Constrained Delaunay Trianglulation ====//
-    tristatus = triangle_context_options( ctx, cmdline );
-    if ( tristatus != TRI_OK ) printf( _("triangle_context_options Error\n") );
+    {
+        // Triangle keeps its exact arithmetic constants and random seed in globals
+        std::lock_guard< std::mutex > lock( ParallelUtil::TriangleMutex() );
+
+        // init
+        ctx = triangle_context_create();
 
-    // Triangulate the polygon
-    tristatus = triangle_mesh_create( ctx, &in );
-    if ( tristatus != TRI_OK ) printf( _("triangle_mesh_create Error\n") );
+        //==== Constrained Delaunay Trianglulation ====//
+        tristatus = triangle_context_options( ctx, cmdline );
+        if ( tristatus != TRI_OK ) printf( _("triangle_context_options Error\n") );
+
+        // Triangulate the polygon
+        tristatus = triangle_mesh_create( ctx, &in );
+        if ( tristatus != TRI_OK ) printf( _("triangle_mesh_create Error\n") );
+    }
 
     if ( tristatus == TRI_OK )
     {
@@ -81,6 +81,18 @@ SubSurface::~SubSurface()
 
 void SubSurface::ParmChanged( Parm* parm_ptr, int type )
 {
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    //==== Parent Geom Meshes Change With Sub Surfaces ====//
+    if ( veh )
+    {
+        Geom* geom = veh->FindGeom( m_CompID );
+        if ( geom )
+        {
+            geom->MarkChanged();
+        }
+    }
+
     if ( type == Parm::SET )
     {
         m_LateUpdateFlag = true;
@@ -89,7 +101,6 @@ void SubSurface::ParmChanged( Parm* parm_ptr, int type )
 
     Update();
 
-    Vehicle* veh = VehicleMgr.GetVehicle();
     if ( veh )
     {
         veh->ParmChanged( parm_ptr, type );
@@ -25,12 +25,14 @@
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
 #include "VspCurve.h" // for #define TMAGIC
+#include "ParallelUtil.h"
 
 #include "triangle.h"
 #include "triangle_api.h"
 
 
 #include <math.h>
+#include <limits>
 
 //===============================================//
 //                  TNode
@@ -472,6 +474,98 @@ void TMesh::CopyFlatten( TMesh* m )
     }
 }
 
+//==== Deep Copy Keeping Split Tris And Their Inside/Ignore Flags ====//
+// Nodes shared between tris in m are shared in the copy too.
+void TMesh::CopyTrimmed( TMesh* m )
+{
+    CopyAttributes( m );
+    m_TVec.clear();
+    m_NVec.clear();
+
+    map< TNode*, TNode* > node_map;
+    auto mesh_node = [&]( TNode* orig_n )
+    {
+        map< TNode*, TNode* >::iterator iter = node_map.find( orig_n );
+        if ( iter != node_map.end() )
+        {
+            return iter->second;
+        }
+        TNode* n = new TNode();
+        n->CopyFrom( orig_n );
+        node_map[ orig_n ] = n;
+        m_NVec.push_back( n );
+        return n;
+    };
+
+    for ( int i = 0 ; i < ( int )m->m_NVec.size() ; i++ )
+    {
+        mesh_node( m->m_NVec[i] );
+    }
+
+    auto copy_tri_data = [&]( TTri* t, const TTri* orig_tri )
+    {
+        t->m_Norm = orig_tri->m_Norm;
+        t->m_IgnoreTriFlag = orig_tri->m_IgnoreTriFlag;
+        t->m_insideSurf = orig_tri->m_insideSurf;
+        t->m_ID = orig_tri->m_ID;
+        t->m_Tags = orig_tri->m_Tags;
+        t->m_Density = orig_tri->m_Density;
+        t->m_InvalidFlag = orig_tri->m_InvalidFlag;
+    };
+
+    for ( int i = 0 ; i < ( int )m->m_TVec.size() ; i++ )
+    {
+        TTri* orig_tri = m->m_TVec[i];
+        TTri* tri = new TTri( this );
+        tri->m_N0 = mesh_node( orig_tri->m_N0 );
+        tri->m_N1 = mesh_node( orig_tri->m_N1 );
+        tri->m_N2 = mesh_node( orig_tri->m_N2 );
+        copy_tri_data( tri, orig_tri );
+        m_TVec.push_back( tri );
+
+        if ( orig_tri->m_SplitVec.empty() )
+        {
+            continue;
+        }
+
+        //==== Split Nodes - First 3 Are The Corners, The Rest Belong To The Tri ====//
+        map< TNode*, TNode* > split_map;
+        for ( int j = 0 ; j < ( int )orig_tri->m_NVec.size() ; j++ )
+        {
+            TNode* orig_n = orig_tri->m_NVec[j];
+            TNode* n;
+            if ( j < 3 )
+            {
+                n = mesh_node( orig_n );
+            }
+            else
+            {
+                n = new TNode();
+                n->CopyFrom( orig_n );
+            }
+            split_map[ orig_n ] = n;
+            tri->m_NVec.push_back( n );
+        }
+
+        for ( int j = 0 ; j < ( int )orig_tri->m_EVec.size() ; j++ )
+        {
+            TEdge* orig_e = orig_tri->m_EVec[j];
+            tri->m_EVec.push_back( new TEdge( split_map[ orig_e->m_N0 ], split_map[ orig_e->m_N1 ], tri ) );
+        }
+
+        for ( int j = 0 ; j < ( int )orig_tri->m_SplitVec.size() ; j++ )
+        {
+            TTri* orig_s_tri = orig_tri->m_SplitVec[j];
+            TTri* s_tri = new TTri( this );
+            s_tri->m_N0 = split_map[ orig_s_tri->m_N0 ];
+            s_tri->m_N1 = split_map[ orig_s_tri->m_N1 ];
+            s_tri->m_N2 = split_map[ orig_s_tri->m_N2 ];
+            copy_tri_data( s_tri, orig_s_tri );
+            tri->m_SplitVec.push_back( s_tri );
+        }
+    }
+}
+
 void TMesh::CopyAttributes( TMesh* m )
 {
     m_PtrID     = m->m_PtrID;
@@ -787,11 +881,20 @@ double TMesh::MinDistance( TMesh* tm, double curr_min_dist )
 
 void TMesh::Split()
 {
-    int t;
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    //==== Only Tris With Intersection Edges Need Work ====//
+    vector< TTri* > split_vec;
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
-        m_TVec[t]->SplitTri();
+        if ( m_TVec[t]->m_ISectEdgeVec.size() )
+        {
+            split_vec.push_back( m_TVec[t] );
+        }
     }
+
+    ParallelUtil::ParallelFor( ( int )split_vec.size(), [&]( int t )
+    {
+        split_vec[t]->SplitTri();
+    } );
 }
 
 bool TMesh::DecideIgnoreTri( int aType, const vector < int > & bTypes, const vector < bool > & thicksurf, const vector < bool > & aInB )
@@ -874,7 +977,7 @@ bool TMesh::DecideIgnoreTri( int aType, const vector < int > & bTypes, const vec
 
 void TMesh::SetIgnoreTriFlag( vector< TMesh* >& meshVec, const vector < int > & bTypes, const vector < bool > & thicksurf )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    ParallelUtil::ParallelFor( ( int )m_TVec.size(), [&]( int t )
     {
         TTri* tri = m_TVec[t];
 
@@ -891,7 +994,7 @@ void TMesh::SetIgnoreTriFlag( vector< TMesh* >& meshVec, const vector < int > &
         {
             tri->m_IgnoreTriFlag = DecideIgnoreTri( m_SurfCfdType, bTypes, thicksurf, tri->m_insideSurf );
         }
-    }
+    } );
 }
 
 void TMesh::IgnoreYLessThan( const double & ytol )
@@ -925,44 +1028,53 @@ void TMesh::IgnoreYLessThan( const double & ytol )
 
 void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
+    //==== Tris To Classify - Split Tris Stand In For Their Parent ====//
+    vector< TTri* > tri_vec;
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
-
-        //==== Do Interior Tris ====//
         if ( tri->m_SplitVec.size() )
         {
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
+            tri_vec.insert( tri_vec.end(), tri->m_SplitVec.begin(), tri->m_SplitVec.end() );
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            tri_vec.push_back( tri );
         }
     }
-}
 
-void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
-{
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_IgnoreTriFlag = false;
-    int prior = -1;
-
-    vec3d dir( 1.0, 0.000001, 0.000001 );
+    vector< vec3d > pnt_vec( tri_vec.size() );
+    for ( int i = 0 ; i < ( int )tri_vec.size() ; i++ )
+    {
+        TTri* tri = tri_vec[i];
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+        pnt_vec[i] = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+    }
 
+    //==== Winding Number Of Every Point, One Batch Per Thick Mesh ====//
+    // Trees are built once per Bnd Box load, before any threads use them.
     int nmesh = meshVec.size();
-    tri->m_insideSurf.resize( nmesh, false );
-
-    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+    vector< vector< double > > wind_vec( nmesh );
+    for ( int m = 0 ; m < nmesh ; m++ )
     {
         if ( meshVec[m] != this && meshVec[m]->m_ThickSurf )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            meshVec[m]->m_TBox.BuildTriTree();
+            meshVec[m]->m_TBox.m_TriTree->WindingNumber( pnt_vec, wind_vec[m] );
+        }
+    }
+
+    ParallelUtil::ParallelFor( ( int )tri_vec.size(), [&]( int i )
+    {
+        TTri* tri = tri_vec[i];
+        tri->m_IgnoreTriFlag = false;
+        int prior = -1;
+
+        tri->m_insideSurf.resize( nmesh, false );
+
+        for ( int m = 0 ; m < nmesh ; m++ )
+        {
+            if ( wind_vec[m].size() && TTriBVH::Inside( wind_vec[m][i] ) )
             {
                 tri->m_insideSurf[m] = true;
 
@@ -975,7 +1087,7 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
                 }
             }
         }
-    }
+    } );
 }
 
 double TMesh::ComputeTheoArea()
@@ -1909,11 +2021,17 @@ void TTri::SplitTri()
     }
 
     //==== Determine Which Axis to Flatten ====//
-    Matrix4d rot_mat;
+    // The corner nodes are shared with neighboring tris, so the rotated points
+    // are copies and the nodes themselves are never moved.
+    vector< vec3d > pnt_vec( m_NVec.size() );
     int flattenAxis = 0;
     if ( uwflag )
     {
         flattenAxis = 2;
+        for ( unsigned int n=0; n < m_NVec.size(); n++ )
+        {
+            pnt_vec[n] = m_NVec[n]->m_Pnt;
+        }
     }
     else
     {
@@ -1925,26 +2043,17 @@ void TTri::SplitTri()
         vec3d axis = cross(m_Norm,vec3d(1,0,0));
 
         // Rotate Points
+        Matrix4d rot_mat;
         rot_mat.rotate(std::acos(costheta), axis);
 
         for ( unsigned int n=0; n < m_NVec.size(); n++ )
         {
-            m_NVec[n]->m_Pnt = rot_mat.xform(m_NVec[n]->m_Pnt);
+            pnt_vec[n] = rot_mat.xform(m_NVec[n]->m_Pnt);
         }
     }
 
     //==== Use Triangle to Split Tri ====//
-    TriangulateSplit( flattenAxis );
-
-    if ( !uwflag )
-    {
-        // Rotate Points Back
-        rot_mat.affineInverse();
-        for ( unsigned int n=0; n < m_NVec.size(); n++ )
-        {
-            m_NVec[n]->m_Pnt = rot_mat.xform(m_NVec[n]->m_Pnt);
-        }
-    }
+    TriangulateSplit( flattenAxis, pnt_vec );
 
     //=== Orient Tris to Match Normal ====//
     for ( i = 0 ; i < ( int )m_SplitVec.size() ; i++ )
@@ -1964,7 +2073,7 @@ void TTri::SplitTri()
     }
 }
 
-void TTri::TriangulateSplit( int flattenAxis )
+void TTri::TriangulateSplit( int flattenAxis, const vector< vec3d > & pnt_vec )
 {
     int i, j;
 
@@ -1973,8 +2082,11 @@ void TTri::TriangulateSplit( int flattenAxis )
     triangleio in, out;
     int tristatus = TRI_NULL;
 
-    // init
-    ctx = triangle_context_create();
+    // init, Triangle keeps its exact arithmetic constants and random seed in globals
+    {
+        std::lock_guard< std::mutex > lock( ParallelUtil::TriangleMutex() );
+        ctx = triangle_context_create();
+    }
 
     memset( &in, 0, sizeof( in ) ); // Load Zeros
     memset( &out, 0, sizeof( out ) );
@@ -2006,9 +2118,9 @@ void TTri::TriangulateSplit( int flattenAxis )
 
     //==== Find Bounds of NVec ====//
     BndBox box;
-    for ( j = 0 ; j < ( int )m_NVec.size() ; j++ )
+    for ( j = 0 ; j < ( int )pnt_vec.size() ; j++ )
     {
-        box.Update( m_NVec[j]->m_Pnt );
+        box.Update( pnt_vec[j] );
     }
 
     vec3d center = box.GetCenter();
@@ -2021,7 +2133,7 @@ void TTri::TriangulateSplit( int flattenAxis )
     int cnt = 0;
     for ( j = 0 ; j < ( int )m_NVec.size() ; j++ )
     {
-        vec3d pnt = m_NVec[j]->m_Pnt - center;
+        vec3d pnt = pnt_vec[j] - center;
         pnt.scale_x( 1.0 / sx );
         pnt.scale_y( 1.0 / sy );
         pnt.scale_z( 1.0 / sz );
@@ -2118,6 +2230,8 @@ void TTri::TriangulateSplit( int flattenAxis )
         {
             char cmdline[] = "zpQ";
 
+            std::lock_guard< std::mutex > lock( ParallelUtil::TriangleMutex() );
+
             //==== Constrained Delaunay Trianglulation ====//
             tristatus = triangle_context_options( ctx, cmdline );
             if ( tristatus != TRI_OK ) printf( "triangle_context_options Error\n" );
@@ -2376,6 +2490,7 @@ TBndBox::TBndBox()
     {
         m_SBoxVec[i] = 0;
     }
+    m_TriTree = NULL;
 }
 
 TBndBox::~TBndBox()
@@ -2384,6 +2499,7 @@ TBndBox::~TBndBox()
     {
         delete m_SBoxVec[i];
     }
+    delete m_TriTree;
 }
 
 void TBndBox::Reset()
@@ -2394,6 +2510,9 @@ void TBndBox::Reset()
         m_SBoxVec[i] = 0;
     }
 
+    delete m_TriTree;
+    m_TriTree = NULL;
+
     m_Box.Reset();
     m_TriVec.clear();
 }
@@ -2562,12 +2681,58 @@ double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
 }
 
 
+static TEdge* NewISectEdge( TTri* tri, const vec3d & e0, const vec3d & e1 )
+{
+    TEdge* ie = new TEdge();
+    int info = TNode::HAS_UW | TNode::HAS_XYZ;
+    ie->m_N0 = new TNode();
+    ie->m_N0->m_Pnt = e0;
+    ie->m_N0->m_UWPnt = tri->CompUW( e0 );
+    ie->m_N0->SetCoordInfo( info );
+    ie->m_N1 = new TNode();
+    ie->m_N1->m_Pnt = e1;
+    ie->m_N1->m_UWPnt = tri->CompUW( e1 );
+    ie->m_N1->SetCoordInfo( info );
+    return ie;
+}
+
+//==== Add Intersection Edges To Both Tris, In Order ====//
+// If tmesh is given only tris belonging to tmesh get edges.
+static void AddISectEdges( const vector< TTriISect > & isect_vec, TMesh* tmesh = NULL )
+{
+    for ( int i = 0 ; i < ( int )isect_vec.size() ; i++ )
+    {
+        TTri* t0 = isect_vec[i].m_T0;
+        TTri* t1 = isect_vec[i].m_T1;
+        const vec3d & e0 = isect_vec[i].m_E0;
+        const vec3d & e1 = isect_vec[i].m_E1;
+
+        if ( !tmesh || t0->GetTMeshPtr() == tmesh )
+        {
+            t0->m_ISectEdgeVec.push_back( NewISectEdge( t0, e0, e1 ) );
+        }
+        if ( !tmesh || t1->GetTMeshPtr() == tmesh )
+        {
+            t1->m_ISectEdgeVec.push_back( NewISectEdge( t1, e0, e1 ) );
+        }
+    }
+}
+
 void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
 {
     int i;
 
     double tol = 1e-6; // was 1e-6
 
+    //==== XYZ Intersections Are Found First, Then Added In The Order Found ====//
+    if ( !UWFlag )
+    {
+        vector< TTriISect > isect_vec;
+        FindIntersect( iBox, isect_vec );
+        AddISectEdges( isect_vec );
+        return;
+    }
+
     if ( !Compare( m_Box, iBox->m_Box ) )
     {
         return;
@@ -2607,91 +2772,59 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
 
                 if ( iflag && !coplanarFlag )
                 {
-                    if ( UWFlag )
+                    if ( dist( e0, e1 ) > tol ) // was 1e-6
                     {
-                        if ( dist( e0, e1 ) > tol ) // was 1e-6
+                        // Figure out with tri has xyz info
+                        TTri* tri;
+                        int d_info = TNode::HAS_XYZ; // desired info number
+                        if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                                && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
                         {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
-
+                            tri = t0;
                         }
-                    }
-                    else
-                    {
-                        if ( dist( e0, e1 ) > tol )
+                        else
+                        {
+                            tri = t1;
+                        }
+                        // Use Bilinear interpolation to convert edge uw points to xyz points
+                        vec3d e0xyz = tri->CompPnt( e0 );
+                        vec3d e1xyz = tri->CompPnt( e1 );
+
+                        // Create the new edges
+
+                        TEdge* ie0 = new TEdge();
+                        int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                        ie0->m_N0 = new TNode();
+                        ie0->m_N0->SetUWPnt( e0 );
+                        ie0->m_N0->SetXYZPnt( e0xyz );
+                        ie0->m_N0->MakePntUW();
+                        ie0->m_N0->SetCoordInfo( info );
+                        ie0->m_N1 = new TNode();
+                        ie0->m_N1->SetUWPnt( e1 );
+                        ie0->m_N1->SetXYZPnt( e1xyz );
+                        ie0->m_N1->MakePntUW();
+                        ie0->m_N1->SetCoordInfo( info );
+
+                        TEdge* ie1 = new TEdge();
+                        ie1->m_N0 = new TNode();
+                        ie1->m_N0->SetUWPnt( e0 );
+                        ie1->m_N0->SetXYZPnt( e0xyz );
+                        ie1->m_N0->MakePntUW();
+                        ie1->m_N0->SetCoordInfo( info );
+                        ie1->m_N1 = new TNode();
+                        ie1->m_N1->SetUWPnt( e1 );
+                        ie1->m_N1->SetXYZPnt( e1xyz );
+                        ie1->m_N1->MakePntUW();
+                        ie1->m_N1->SetCoordInfo( info );
+
+                        t0->m_ISectEdgeVec.push_back( ie0 );
+                        t1->m_ISectEdgeVec.push_back( ie1 );
+
+                        if ( tri->GetTMeshPtr() )
                         {
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->m_Pnt = e0;
-                            ie0->m_N0->m_UWPnt = t0->CompUW( e0 );
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->m_Pnt = e1;
-                            ie0->m_N1->m_UWPnt = t0->CompUW( e1 );
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->m_Pnt = e0;
-                            ie1->m_N0->m_UWPnt = t1->CompUW( e0 );
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->m_Pnt = e1;
-                            ie1->m_N1->m_UWPnt = t1->CompUW( e1 );
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
+                            tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
                         }
+
                     }
                 }
             }
@@ -2699,10 +2832,113 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
     }
 }
 
+//==== Find XYZ Intersections Without Changing Either Box ====//
+void TBndBox::FindIntersect( TBndBox* iBox, vector< TTriISect > & isect_vec )
+{
+    int i;
+
+    double tol = 1e-6;
+
+    if ( !Compare( m_Box, iBox->m_Box ) )
+    {
+        return;
+    }
+
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            iBox->FindIntersect( m_SBoxVec[i], isect_vec );
+        }
+    }
+    else if ( iBox->m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            iBox->m_SBoxVec[i]->FindIntersect( this, isect_vec );
+        }
+    }
+    else
+    {
+        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            {
+                TTri* t1 = iBox->m_TriVec[j];
+
+                int coplanarFlag = 0; // Must be initialized to 0 before use in tri_tri_intersection_test_3d
+                vec3d e0;
+                vec3d e1;
+
+                int iflag = tri_tri_intersection_test_3d(
+                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                &coplanarFlag, e0.v, e1.v );
+
+                if ( iflag && !coplanarFlag && dist( e0, e1 ) > tol )
+                {
+                    TTriISect isect;
+                    isect.m_T0 = t0;
+                    isect.m_T1 = t1;
+                    isect.m_E0 = e0;
+                    isect.m_E1 = e1;
+                    isect_vec.push_back( isect );
+                }
+            }
+        }
+    }
+}
+
+//==== Descend Both Trees Like FindIntersect, Stopping After depth Levels ====//
+// The box pairs are listed in the order FindIntersect would visit them.
+void TBndBox::SplitIntersect( TBndBox* iBox, int depth, vector< TBndBox* > & box_vec, vector< TBndBox* > & ibox_vec )
+{
+    if ( !Compare( m_Box, iBox->m_Box ) )
+    {
+        return;
+    }
+
+    if ( depth > 0 && m_SBoxVec[0] )
+    {
+        for ( int i = 0 ; i < 8 ; i++ )
+        {
+            iBox->SplitIntersect( m_SBoxVec[i], depth - 1, box_vec, ibox_vec );
+        }
+    }
+    else if ( depth > 0 && iBox->m_SBoxVec[0] )
+    {
+        for ( int i = 0 ; i < 8 ; i++ )
+        {
+            iBox->m_SBoxVec[i]->SplitIntersect( this, depth - 1, box_vec, ibox_vec );
+        }
+    }
+    else
+    {
+        box_vec.push_back( this );
+        ibox_vec.push_back( iBox );
+    }
+}
+
+void TBndBox::BuildTriTree()
+{
+    if ( !m_TriTree )
+    {
+        m_TriTree = new TTriBVH();
+        m_TriTree->Build( m_TriVec );
+    }
+}
+
 void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
 {
     int i;
 
+    if ( m_TriTree )
+    {
+        m_TriTree->RayCast( orig, dir, tParmVec );
+        return;
+    }
+
     double coord[3];
 
     if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
@@ -2750,6 +2986,501 @@ void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
 
 }
 
+//==== Flat BVH Over Tris ====//
+void TTriBVH::Build( const vector< TTri* > & tri_vec )
+{
+    m_NodeVec.clear();
+    m_VertVec.clear();
+
+    int ntri = ( int )tri_vec.size();
+    if ( ntri == 0 )
+    {
+        return;
+    }
+
+    vector< int > ind_vec( ntri );
+    vector< vec3d > cen_vec( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        ind_vec[i] = i;
+        cen_vec[i] = ( tri_vec[i]->m_N0->m_Pnt + tri_vec[i]->m_N1->m_Pnt + tri_vec[i]->m_N2->m_Pnt ) / 3.0;
+    }
+
+    m_NodeVec.reserve( 2 * ( ntri / 4 + 1 ) );
+    m_VertVec.resize( 9 * ntri );
+
+    BuildNode( ind_vec, cen_vec, tri_vec, 0, ntri );
+}
+
+int TTriBVH::BuildNode( vector< int > & ind_vec, const vector< vec3d > & cen_vec, const vector< TTri* > & tri_vec, int begin, int end )
+{
+    const int leaf_size = 4;
+
+    int node_ind = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( BVHNode() );
+
+    //==== Bounds Of Tris And Of Their Centers ====//
+    BndBox box;
+    BndBox cen_box;
+    for ( int i = begin ; i < end ; i++ )
+    {
+        TTri* t = tri_vec[ ind_vec[i] ];
+        box.Update( t->m_N0->m_Pnt );
+        box.Update( t->m_N1->m_Pnt );
+        box.Update( t->m_N2->m_Pnt );
+        cen_box.Update( cen_vec[ ind_vec[i] ] );
+    }
+
+    // Pad so rays grazing a face are not lost to round off in the slab test.
+    double pad = 1.0e-9 * box.DiagDist() + 1.0e-12;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        m_NodeVec[node_ind].m_Min[k] = box.GetMin( k ) - pad;
+        m_NodeVec[node_ind].m_Max[k] = box.GetMax( k ) + pad;
+    }
+
+    if ( end - begin <= leaf_size )
+    {
+        //==== Copy Vertices Out In Leaf Order ====//
+        vec3d area_norm;
+        vec3d area_cen;
+        double area_sum = 0.0;
+        for ( int i = begin ; i < end ; i++ )
+        {
+            TTri* t = tri_vec[ ind_vec[i] ];
+            double* v = &m_VertVec[ 9 * i ];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                v[k] = t->m_N0->m_Pnt[k];
+                v[k + 3] = t->m_N1->m_Pnt[k];
+                v[k + 6] = t->m_N2->m_Pnt[k];
+            }
+
+            vec3d an = cross( t->m_N1->m_Pnt - t->m_N0->m_Pnt, t->m_N2->m_Pnt - t->m_N0->m_Pnt ) * 0.5;
+            double a = an.mag();
+            area_norm = area_norm + an;
+            area_cen = area_cen + cen_vec[ ind_vec[i] ] * a;
+            area_sum += a;
+        }
+
+        SetDipole( m_NodeVec[node_ind], area_norm, area_cen, area_sum );
+        SetRadius( m_NodeVec[node_ind], begin, end );
+
+        m_NodeVec[node_ind].m_Start = begin;
+        m_NodeVec[node_ind].m_Count = end - begin;
+        return node_ind;
+    }
+
+    //==== Median Split Along Longest Axis Of Centers ====//
+    int axis = 0;
+    for ( int k = 1 ; k < 3 ; k++ )
+    {
+        if ( cen_box.GetMax( k ) - cen_box.GetMin( k ) > cen_box.GetMax( axis ) - cen_box.GetMin( axis ) )
+        {
+            axis = k;
+        }
+    }
+
+    int mid = ( begin + end ) / 2;
+    nth_element( ind_vec.begin() + begin, ind_vec.begin() + mid, ind_vec.begin() + end, [&]( int a, int b )
+    {
+        return cen_vec[a][axis] < cen_vec[b][axis];
+    } );
+
+    int left = BuildNode( ind_vec, cen_vec, tri_vec, begin, mid );
+    int right = BuildNode( ind_vec, cen_vec, tri_vec, mid, end );
+
+    //==== Combine Children Dipoles ====//
+    const BVHNode & lnode = m_NodeVec[left];
+    const BVHNode & rnode = m_NodeVec[right];
+    vec3d area_norm = NodeAreaNorm( lnode ) + NodeAreaNorm( rnode );
+    vec3d area_cen = NodeCen( lnode ) * lnode.m_Area + NodeCen( rnode ) * rnode.m_Area;
+    double area_sum = lnode.m_Area + rnode.m_Area;
+
+    BVHNode & node = m_NodeVec[node_ind];
+    SetDipole( node, area_norm, area_cen, area_sum );
+    SetRadius( node, begin, end );
+
+    node.m_Start = right;
+    node.m_Count = 0;
+    return node_ind;
+}
+
+void TTriBVH::SetDipole( BVHNode & node, const vec3d & area_norm, const vec3d & area_cen, double area_sum )
+{
+    vec3d cen;
+    if ( area_sum > 0.0 )
+    {
+        cen = area_cen / area_sum;
+    }
+    else
+    {
+        // Degenerate tris only, the box center will do.
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            cen[k] = 0.5 * ( node.m_Min[k] + node.m_Max[k] );
+        }
+    }
+
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        node.m_AreaNorm[k] = area_norm[k];
+        node.m_Cen[k] = cen[k];
+    }
+    node.m_Area = area_sum;
+}
+
+//==== Tightest Sphere About The Dipole Center, From The Leaf Ordered Vertices ====//
+void TTriBVH::SetRadius( BVHNode & node, int begin, int end ) const
+{
+    vec3d cen = NodeCen( node );
+    double r2 = 0.0;
+    for ( int i = 9 * begin ; i < 9 * end ; i += 3 )
+    {
+        r2 = std::max( r2, dist_squared( vec3d( m_VertVec[i], m_VertVec[i + 1], m_VertVec[i + 2] ), cen ) );
+    }
+    node.m_Radius = sqrt( r2 );
+}
+
+//==== Winding Number Of One Point ====//
+double TTriBVH::WindingNumber( const vec3d & pnt ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return 0.0;
+    }
+
+    // Nodes farther than beta times their radius use the dipole term.
+    const double beta = 2.0;
+
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+
+    double solid_angle = 0.0;
+
+    while ( nstack > 0 )
+    {
+        const BVHNode & node = m_NodeVec[ stack[--nstack] ];
+
+        vec3d r = NodeCen( node ) - pnt;
+        double d = r.mag();
+
+        if ( d > beta * node.m_Radius )
+        {
+            solid_angle += dot( NodeAreaNorm( node ), r ) / ( d * d * d );
+            continue;
+        }
+
+        if ( node.m_Count == 0 )
+        {
+            int left = ( int )( &node - &m_NodeVec[0] ) + 1;
+            stack[nstack++] = node.m_Start;
+            stack[nstack++] = left;
+            continue;
+        }
+
+        //==== Exact Solid Angle Of Each Tri (Van Oosterom And Strackee) ====//
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            const double* v = &m_VertVec[ 9 * i ];
+            vec3d a = vec3d( v[0], v[1], v[2] ) - pnt;
+            vec3d b = vec3d( v[3], v[4], v[5] ) - pnt;
+            vec3d c = vec3d( v[6], v[7], v[8] ) - pnt;
+
+            double la = a.mag();
+            double lb = b.mag();
+            double lc = c.mag();
+
+            double numer = dot( a, cross( b, c ) );
+            double denom = la * lb * lc + dot( a, b ) * lc + dot( b, c ) * la + dot( c, a ) * lb;
+
+            solid_angle += 2.0 * atan2( numer, denom );
+        }
+    }
+
+    return solid_angle / ( 4.0 * PI );
+}
+
+//==== Winding Numbers Of A Batch Of Points ====//
+void TTriBVH::WindingNumber( const vector< vec3d > & pnt_vec, vector< double > & wind_vec ) const
+{
+    wind_vec.resize( pnt_vec.size() );
+
+    ParallelUtil::ParallelFor( ( int )pnt_vec.size(), [&]( int i )
+    {
+        wind_vec[i] = WindingNumber( pnt_vec[i] );
+    } );
+}
+
+void TTriBVH::RayCast( const vec3d & orig, const vec3d & dir, vector<double> & tParmVec ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    double o[3] = { orig.x(), orig.y(), orig.z() };
+    double d[3] = { dir.x(), dir.y(), dir.z() };
+    double inv_d[3];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        inv_d[k] = 1.0 / d[k];
+    }
+
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+
+    double tparm, uparm, vparm;
+
+    while ( nstack > 0 )
+    {
+        const BVHNode & node = m_NodeVec[ stack[--nstack] ];
+
+        //==== Slab Test, Rays Only Go Forward ====//
+        double tmin = 0.0;
+        double tmax = std::numeric_limits< double >::max();
+        bool hit = true;
+        for ( int k = 0 ; k < 3 && hit ; k++ )
+        {
+            double t0 = ( node.m_Min[k] - o[k] ) * inv_d[k];
+            double t1 = ( node.m_Max[k] - o[k] ) * inv_d[k];
+            if ( t0 > t1 )
+            {
+                std::swap( t0, t1 );
+            }
+            tmin = std::max( tmin, t0 );
+            tmax = std::min( tmax, t1 );
+            hit = tmin <= tmax;
+        }
+
+        if ( !hit )
+        {
+            continue;
+        }
+
+        if ( node.m_Count == 0 )
+        {
+            int left = ( int )( &node - &m_NodeVec[0] ) + 1;
+            stack[nstack++] = node.m_Start;
+            stack[nstack++] = left;
+            continue;
+        }
+
+        //==== Check All Tris In Leaf ====//
+        for ( int i = node.m_Start ; i < node.m_Start + node.m_Count ; i++ )
+        {
+            double* v = const_cast< double* >( &m_VertVec[ 9 * i ] );
+            int iFlag = intersect_triangle( o, d, v, v + 3, v + 6, &tparm, &uparm, &vparm );
+
+            if ( iFlag && tparm > 0.0 )
+            {
+                //==== Find If T is Already Included ====//
+                int dupFlag = 0;
+                for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+                {
+                    if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                    {
+                        dupFlag = 1;
+                        break;
+                    }
+                }
+
+                if ( !dupFlag )
+                {
+                    tParmVec.push_back( tparm );
+                }
+            }
+        }
+    }
+}
+
+//==== Intersect Every Pair Of Meshes In Parallel ====//
+// Same result as calling TMesh::Intersect for every pair in order.  The box
+// trees are paired down a few levels, the pairs are intersected on threads
+// and the edges are added afterwards in the order a serial pass finds them.
+void IntersectTMeshVec( vector < TMesh* > & TMeshVec )
+{
+    vector< TBndBox* > box_vec;
+    vector< TBndBox* > ibox_vec;
+    for ( int i = 0 ; i < ( int )TMeshVec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )TMeshVec.size() ; j++ )
+        {
+            TMeshVec[i]->m_TBox.SplitIntersect( &TMeshVec[j]->m_TBox, 3, box_vec, ibox_vec );
+        }
+    }
+
+    vector< vector< TTriISect > > isect_vec( box_vec.size() );
+    ParallelUtil::ParallelFor( ( int )box_vec.size(), [&]( int i )
+    {
+        box_vec[i]->FindIntersect( ibox_vec[i], isect_vec[i] );
+    } );
+
+    for ( int i = 0 ; i < ( int )isect_vec.size() ; i++ )
+    {
+        AddISectEdges( isect_vec[i] );
+    }
+}
+
+//==== Intersect, Adding Edges To This Mesh Only ====//
+// tm is only read, so many meshes may be cut against it at once.
+void TMesh::IntersectOneSided( TMesh* tm )
+{
+    vector< TTriISect > isect_vec;
+    m_TBox.FindIntersect( &tm->m_TBox, isect_vec );
+    AddISectEdges( isect_vec, this );
+}
+
+//==== Cut Every Slice Against The Meshes In Parallel ====//
+// Each slice is intersected, split and classified on its own thread.  Isect
+// edges only go on the slice tris and the meshes are just read, so slices
+// don't touch each other.  The meshes come out with no isect edges, as they
+// did when slices were cut one at a time.
+void SliceTMeshVec( vector < TMesh* > & SliceVec, vector < TMesh* > & TMeshVec )
+{
+    // Fill vector of cfdtypes so we don't have to pass TMeshVec all the way down.
+    vector < int > bTypes( TMeshVec.size() );
+    vector < bool > thicksurf( TMeshVec.size() );
+    for ( int i = 0 ; i < ( int )TMeshVec.size() ; i++ )
+    {
+        bTypes[i] = TMeshVec[i]->m_SurfCfdType;
+        thicksurf[i] = TMeshVec[i]->m_ThickSurf;
+        TMeshVec[i]->RemoveIsectEdges();
+
+        //==== Trees Are Shared By Every Slice, Build Them Up Front ====//
+        if ( TMeshVec[i]->m_ThickSurf )
+        {
+            TMeshVec[i]->m_TBox.BuildTriTree();
+        }
+    }
+
+    ParallelUtil::ParallelFor( ( int )SliceVec.size(), [&]( int s )
+    {
+        TMesh* tm = SliceVec[s];
+        tm->LoadBndBox();
+
+        //==== Intersect All Mesh Geoms ====//
+        for ( int i = 0 ; i < ( int )TMeshVec.size() ; i++ )
+        {
+            tm->IntersectOneSided( TMeshVec[i] );
+        }
+
+        //==== Split Intersected Tri in Mesh ====//
+        tm->Split();
+
+        //==== Determine Which Triangles Are Interior/Exterior ====//
+        tm->DeterIntExt( TMeshVec );
+
+        //==== Mark which triangles to ignore ====//
+        tm->SetIgnoreTriFlag( TMeshVec, bTypes, thicksurf );
+    } );
+}
+
+//==== Compact Indexed Tri Storage ====//
+void TIndexedMesh::Clear()
+{
+    m_PntVec.clear();
+    m_UWVec.clear();
+    m_TriVec.clear();
+    m_TagVec.clear();
+    m_FlagVec.clear();
+    m_TagKeyMap.clear();
+}
+
+//==== Merge Nodes Closer Than tol And Drop Tris That Collapse ====//
+void TIndexedMesh::Build( const vector< TTri* > & tri_vec, double tol )
+{
+    Clear();
+
+    int ntri = ( int )tri_vec.size();
+    if ( ntri == 0 )
+    {
+        return;
+    }
+
+    //==== Collect All Points ====//
+    vector< vec3d > all_pnt_vec( 3 * ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            all_pnt_vec[ 3 * t + i ] = tri_vec[t]->GetTriNode( i )->m_Pnt;
+        }
+    }
+
+    //==== Use NanoFlann to Find Close Points and Group ====//
+    PntNodeCloud pnCloud;
+    pnCloud.AddPntNodes( all_pnt_vec );
+    IndexPntNodes( pnCloud, tol );
+
+    //==== Load Used Nodes ====//
+    m_PntVec.reserve( 3 * pnCloud.m_NumUsedPts );
+    for ( int i = 0 ; i < 3 * ntri ; i++ )
+    {
+        if ( pnCloud.UsedNode( i ) )
+        {
+            TNode* n = tri_vec[ i / 3 ]->GetTriNode( i % 3 );
+            m_PntVec.push_back( n->m_Pnt.x() );
+            m_PntVec.push_back( n->m_Pnt.y() );
+            m_PntVec.push_back( n->m_Pnt.z() );
+        }
+    }
+
+    //==== Load Tris, Removing Any Bogus Ones ====//
+    m_TriVec.reserve( 3 * ntri );
+    m_UWVec.reserve( 6 * ntri );
+    m_TagVec.reserve( ntri );
+    m_FlagVec.reserve( ntri );
+    for ( int t = 0 ; t < ntri ; t++ )
+    {
+        int n0 = pnCloud.GetNodeUsedIndex( 3 * t );
+        int n1 = pnCloud.GetNodeUsedIndex( 3 * t + 1 );
+        int n2 = pnCloud.GetNodeUsedIndex( 3 * t + 2 );
+
+        if ( n0 != n1 && n0 != n2 && n1 != n2 )
+        {
+            TTri* tri = tri_vec[t];
+            int tag = SubSurfaceMgr.GetTag( tri->m_Tags );
+
+            m_TriVec.push_back( n0 );
+            m_TriVec.push_back( n1 );
+            m_TriVec.push_back( n2 );
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                m_UWVec.push_back( tri->GetTriNode( i )->m_UWPnt.x() );
+                m_UWVec.push_back( tri->GetTriNode( i )->m_UWPnt.y() );
+            }
+            m_TagVec.push_back( tag );
+            m_FlagVec.push_back( ( uint8_t )( tri->WakeEdge() & WAKE_EDGE_MASK ) );
+
+            if ( m_TagKeyMap.find( tag ) == m_TagKeyMap.end() )
+            {
+                m_TagKeyMap[ tag ] = tri->m_Tags;
+            }
+        }
+    }
+}
+
+string TIndexedMesh::GetTagNames( int t ) const
+{
+    map< int, vector< int > >::const_iterator it = m_TagKeyMap.find( m_TagVec[t] );
+    if ( it != m_TagKeyMap.end() )
+    {
+        return SubSurfaceMgr.GetTagNames( it->second );
+    }
+    return string( "Error_Tag" );
+}
+
+void TIndexedMesh::LoadTNode( int t, int i, TNode & node ) const
+{
+    node.m_ID = GetTriNode( t, i );
+    node.m_Pnt = GetPnt( node.m_ID );
+    node.m_UWPnt = GetUW( t, i );
+    node.SetCoordInfo( TNode::HAS_UW | TNode::HAS_XYZ );
+}
+
 //===============================================//
 //===============================================//
 //===============================================//
@@ -25,6 +25,8 @@
 #include "XmlUtil.h"
 
 #include <vector>               //jrg windows?? 
+#include <cstdint>
+#include <cmath>
 #include <algorithm>            //jrg windows??
 #include <string>
 #include <map>
@@ -286,7 +288,7 @@ public:
 
     virtual void CopyFrom( const TTri* tri );
     virtual void SplitTri();              // Split Tri to Fit ISect Edges
-    virtual void TriangulateSplit( int flattenAxis );
+    virtual void TriangulateSplit( int flattenAxis, const vector< vec3d > & pnt_vec );
     virtual vec3d ComputeCenter()
     {
         return ( m_N0->m_Pnt + m_N1->m_Pnt + m_N2->m_Pnt ) / 3.0;
@@ -360,6 +362,71 @@ private:
 
 };
 
+//==== Intersection Segment Found Between Two Tris ====//
+class TTriISect
+{
+public:
+    TTri* m_T0;
+    TTri* m_T1;
+    vec3d m_E0;
+    vec3d m_E1;
+};
+
+//==== Flat Bounding Volume Hierarchy Over Tris ====//
+// Nodes are stored depth first in one vector (left child follows its parent)
+// and the tri vertices are copied out in leaf order, so queries walk
+// contiguous memory instead of chasing octree and node pointers.
+//
+// Besides ray casts the tree answers inside/outside queries with the fast
+// winding number: exact tri solid angles nearby, and the area weighted normal
+// of a whole node as a dipole once the point is far enough from it.  The
+// winding number is about 1 inside a closed mesh and 0 outside, for either
+// orientation of the tris its sign flips.
+class TTriBVH
+{
+public:
+    void Build( const vector< TTri* > & tri_vec );
+    void RayCast( const vec3d & orig, const vec3d & dir, vector<double> & tParmVec ) const;
+
+    double WindingNumber( const vec3d & pnt ) const;
+    void WindingNumber( const vector< vec3d > & pnt_vec, vector< double > & wind_vec ) const;
+
+    static bool Inside( double wind )
+    {
+        return std::abs( wind ) > 0.5;
+    }
+
+protected:
+
+    struct BVHNode
+    {
+        double m_Min[3];
+        double m_Max[3];
+        double m_AreaNorm[3];   // Sum of tri area times unit normal
+        double m_Cen[3];        // Area weighted center of tris
+        double m_Area;
+        double m_Radius;        // Sphere about m_Cen holding all tris
+        int m_Start;            // Leaf - first tri, interior - index of right child
+        int m_Count;            // Number of tris in leaf, zero for interior nodes
+    };
+
+    int BuildNode( vector< int > & ind_vec, const vector< vec3d > & cen_vec, const vector< TTri* > & tri_vec, int begin, int end );
+    static void SetDipole( BVHNode & node, const vec3d & area_norm, const vec3d & area_cen, double area_sum );
+    void SetRadius( BVHNode & node, int begin, int end ) const;
+
+    static vec3d NodeCen( const BVHNode & node )
+    {
+        return vec3d( node.m_Cen[0], node.m_Cen[1], node.m_Cen[2] );
+    }
+    static vec3d NodeAreaNorm( const BVHNode & node )
+    {
+        return vec3d( node.m_AreaNorm[0], node.m_AreaNorm[1], node.m_AreaNorm[2] );
+    }
+
+    vector< BVHNode > m_NodeVec;
+    vector< double > m_VertVec; // Nine doubles per tri
+};
+
 class TBndBox
 {
 public:
@@ -373,9 +440,14 @@ public:
 
     TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
 
+    TTriBVH* m_TriTree;         // Optional, for RayCast and inside tests of the top box
+
     void SplitBox();
     void AddTri( TTri* t );
     virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
+    virtual void FindIntersect( TBndBox* iBox, vector< TTriISect > & isect_vec );
+    virtual void SplitIntersect( TBndBox* iBox, int depth, vector< TBndBox* > & box_vec, vector< TBndBox* > & ibox_vec );
+    virtual void BuildTriTree();
     virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
 
     virtual bool CheckIntersect( TBndBox* iBox );
@@ -399,6 +471,7 @@ public:
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
+    void CopyTrimmed( TMesh* m );
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
@@ -432,6 +505,7 @@ public:
     int  RemoveDegenerate();
     void RemoveIsectEdges();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    void IntersectOneSided( TMesh* tm );
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
@@ -441,7 +515,6 @@ public:
     void IgnoreYLessThan( const double & ytol );
 
     void DeterIntExt( vector< TMesh* >& meshVec );
-    void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
 
     void LoadBndBox();
 
@@ -523,6 +596,63 @@ protected:
 
 };
 
+//==== Compact Indexed Tri Storage ====//
+// Nodes live in a flat xyz array and tris are int32 node index triples
+// with their corner uw, a tag and a packed flag byte each.  uw stays per
+// corner since merged nodes on seams and intersections differ in uw.
+// Built from a list of tris with coincident nodes merged, it holds what
+// the exporters need without keeping a TTri and three TNodes per tri.
+class TIndexedMesh
+{
+public:
+    enum { WAKE_EDGE_MASK = 0x03 };   // Flag bits holding TTri::WakeEdge()
+
+    void Clear();
+    void Build( const vector< TTri* > & tri_vec, double tol );
+
+    int NumNodes() const
+    {
+        return ( int )m_PntVec.size() / 3;
+    }
+    int NumTris() const
+    {
+        return ( int )m_TagVec.size();
+    }
+
+    vec3d GetPnt( int n ) const
+    {
+        return vec3d( m_PntVec[ 3 * n ], m_PntVec[ 3 * n + 1 ], m_PntVec[ 3 * n + 2 ] );
+    }
+    vec3d GetUW( int t, int i ) const
+    {
+        return vec3d( m_UWVec[ 6 * t + 2 * i ], m_UWVec[ 6 * t + 2 * i + 1 ], 0 );
+    }
+    int GetTriNode( int t, int i ) const
+    {
+        return m_TriVec[ 3 * t + i ];
+    }
+    int GetTag( int t ) const
+    {
+        return m_TagVec[t];
+    }
+    int GetWakeEdge( int t ) const
+    {
+        return m_FlagVec[t] & WAKE_EDGE_MASK;
+    }
+    string GetTagNames( int t ) const;
+
+    // Fill a stand in TNode for corner i of tri t, for code written for TNodes.
+    void LoadTNode( int t, int i, TNode & node ) const;
+
+protected:
+    vector< double > m_PntVec;          // x, y, z per node
+    vector< double > m_UWVec;           // u, w per tri corner
+    vector< int32_t > m_TriVec;         // n0, n1, n2 per tri
+    vector< int > m_TagVec;             // SubSurfaceMgr tag per tri
+    vector< uint8_t > m_FlagVec;        // Packed flags per tri
+    map< int, vector< int > > m_TagKeyMap;  // Tag to the tag list it came from
+};
+
 void CreateTMeshVecFromPts( const Geom * geom,
                             vector < TMesh* > & TMeshVec,
                             const vector< vector<vec3d> > & pnts,
@@ -531,4 +661,7 @@ void CreateTMeshVecFromPts( const Geom * geom,
                             int indx, int surftype, int cfdsurftype, bool thicksurf, bool flipnormal, double wmax );
 
 void BuildTMeshTris( TMesh *tmesh, bool f_norm, double wmax );
+
+void IntersectTMeshVec( vector < TMesh* > & TMeshVec );
+void SliceTMeshVec( vector < TMesh* > & SliceVec, vector < TMesh* > & TMeshVec );
 #endif
@@ -464,6 +464,8 @@ void Vehicle::Wype()
 
     m_BEMPropID = string();
 
+    m_TrimmedMeshCache.Clear();
+
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
     {
         delete m_GeomStoreVec[i];
@@ -929,6 +931,9 @@ string Vehicle::AddMeshGeom( int normal_set, int degen_set, bool suppressdisks )
 
     MeshGeom* mesh_geom = ( MeshGeom* )( geom_ptr );
 
+    // Trimmed mesh cache key - each Geom that adds meshes, with its change stamp.
+    string cache_key = suppressdisks ? "NODISK" : "DISK";
+
     if ( normal_set >= SET_FIRST_USER )
     {
         mesh_geom->SetSetFlag( normal_set, true );
@@ -946,6 +951,8 @@ string Vehicle::AddMeshGeom( int normal_set, int degen_set, bool suppressdisks )
         {
             if ( g_ptr->GetSetFlag( normal_set ) )
             {
+                cache_key += ";N" + g_ptr->GetID() + ":" + std::to_string( g_ptr->GetChangeStamp() );
+
                 vector< TMesh* > tMeshVec = g_ptr->CreateTMeshVec();
                 for ( int j = 0 ; j < ( int )tMeshVec.size() ; j++ )
                 {
@@ -964,6 +971,8 @@ string Vehicle::AddMeshGeom( int normal_set, int degen_set, bool suppressdisks )
             {
                 if( g_ptr->GetType().m_Type != BLANK_GEOM_TYPE )
                 {
+                    cache_key += ";D" + g_ptr->GetID() + ":" + std::to_string( g_ptr->GetChangeStamp() );
+
                     vector< DegenGeom > DegenGeomVec; // Vector of geom in degenerate representation
 
                     g_ptr->CreateDegenGeom( DegenGeomVec, true );
@@ -995,6 +1004,7 @@ string Vehicle::AddMeshGeom( int normal_set, int degen_set, bool suppressdisks )
         }
     }
 
+    mesh_geom->m_TrimCacheKey = cache_key;
     mesh_geom->m_SurfDirty = true;
 
     SetActiveGeom( id );
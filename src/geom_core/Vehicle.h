@@ -28,6 +28,7 @@
 #include "MaterialMgr.h"
 #include "WaveDragMgr.h"
 #include "GroupTransformations.h"
+#include "MeshGeom.h"
 
 #include <cassert>
 
@@ -84,6 +85,8 @@ public:
     string AddGeom( Geom* add_geom );
     string AddMeshGeom( int normal_set, int degen_set = vsp::SET_NONE, bool suppressdisks = false );
 
+    TrimmedMeshCache* GetTrimmedMeshCache()                          { return &m_TrimmedMeshCache; }
+
     virtual void AddLinkableContainers( vector< string > & linkable_container_vec );
 
     //==== Get All Geoms (Does NOT Return Collapsed Geoms if check_display_flag == true) ====//
@@ -555,6 +558,9 @@ protected:
     // Color of lines in XSecViewScreen
     vec3d m_XSecLineColor;
 
+    // Intersected and trimmed meshes of the last CompGeom, MassProp or WaveDrag
+    TrimmedMeshCache m_TrimmedMeshCache;
+
 private:
 
     void Wype();
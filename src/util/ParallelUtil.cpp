@@ -0,0 +1,145 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//==== Set While A Thread Runs Items Of A Threaded ParallelFor ====//
+static thread_local bool s_InParallelFor = false;
+
+int ParallelUtil::GetNumThreads()
+{
+    int n = ( int )std::thread::hardware_concurrency();
+    return std::max( n, 1 );
+}
+
+void ParallelUtil::ParallelFor( int n, const std::function< void ( int ) > &fun, int num_threads )
+{
+    if ( n <= 0 )
+    {
+        return;
+    }
+
+    if ( num_threads <= 0 )
+    {
+        num_threads = GetNumThreads();
+    }
+    num_threads = std::min( num_threads, n );
+
+    //==== Nothing To Gain From Threads, Or Already Threaded ====//
+    if ( num_threads <= 1 || s_InParallelFor )
+    {
+        for ( int i = 0 ; i < n ; i++ )
+        {
+            fun( i );
+        }
+        return;
+    }
+
+    std::atomic< int > next( 0 );
+    std::atomic< bool > failed( false );
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    auto worker = [&]()
+    {
+        bool was_in = s_InParallelFor;
+        s_InParallelFor = true;
+
+        int i;
+        while ( !failed && ( i = next++ ) < n )
+        {
+            try
+            {
+                fun( i );
+            }
+            catch ( ... )
+            {
+                std::lock_guard< std::mutex > lock( error_mutex );
+                if ( !first_error )
+                {
+                    first_error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+
+        s_InParallelFor = was_in;
+    };
+
+    //==== Calling Thread Works Too ====//
+    std::vector< std::thread > threads;
+    threads.reserve( num_threads - 1 );
+    for ( int t = 0 ; t < num_threads - 1 ; t++ )
+    {
+        threads.emplace_back( worker );
+    }
+
+    worker();
+
+    for ( int t = 0 ; t < ( int )threads.size() ; t++ )
+    {
+        threads[t].join();
+    }
+
+    if ( first_error )
+    {
+        std::rethrow_exception( first_error );
+    }
+}
+
+void ParallelUtil::ParallelWrite( FILE* fp, int n, const std::function< void ( int, std::string & ) > &fun, int num_threads )
+{
+    if ( !fp || n <= 0 )
+    {
+        return;
+    }
+
+    if ( num_threads <= 0 )
+    {
+        num_threads = GetNumThreads();
+    }
+
+    const int chunk_size = 4096;
+    int nchunk = ( n + chunk_size - 1 ) / chunk_size;
+
+    //==== Bound Memory To A Few Chunks Per Thread ====//
+    int batch_size = 4 * num_threads;
+    std::vector< std::string > bufs( std::min( batch_size, nchunk ) );
+
+    for ( int batch_start = 0 ; batch_start < nchunk ; batch_start += batch_size )
+    {
+        int nbatch = std::min( batch_size, nchunk - batch_start );
+
+        ParallelFor( nbatch, [&]( int b )
+        {
+            std::string & buf = bufs[b];
+            buf.clear();
+
+            int start = ( batch_start + b ) * chunk_size;
+            int end = std::min( start + chunk_size, n );
+            for ( int i = start ; i < end ; i++ )
+            {
+                fun( i, buf );
+            }
+        }, num_threads );
+
+        for ( int b = 0 ; b < nbatch ; b++ )
+        {
+            fwrite( bufs[b].data(), 1, bufs[b].size(), fp );
+        }
+    }
+}
+
+std::mutex & ParallelUtil::TriangleMutex()
+{
+    static std::mutex triangle_mutex;
+    return triangle_mutex;
+}
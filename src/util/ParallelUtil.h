@@ -0,0 +1,41 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#if !defined(PARALLEL_UTIL__INCLUDED_)
+#define PARALLEL_UTIL__INCLUDED_
+
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+
+//==== Simple Task Pool For Independent Work Items =====//
+namespace ParallelUtil
+{
+
+// Number of hardware threads, at least one.
+int GetNumThreads();
+
+// Call fun( i ) for i = 0 .. n - 1 on up to num_threads threads (0 uses every
+// hardware thread).  Items are handed out one at a time, in order, so long
+// items do not hold up the rest.  fun must only touch data owned by item i,
+// or guard shared data itself.  Returns when every item is done.  If an item
+// throws, no new items are started and the first exception is rethrown here.
+// A ParallelFor called from inside an item runs serially on that thread.
+void ParallelFor( int n, const std::function< void ( int ) > &fun, int num_threads = 0 );
+
+// Write items i = 0 .. n - 1 to fp in order, fun( i, buf ) appends the text
+// of item i to buf.  Items are formatted in chunks on up to num_threads
+// threads and each chunk goes out with one fwrite, so the file is the same
+// as a serial loop over fun.  fun must be safe to call concurrently.
+void ParallelWrite( FILE* fp, int n, const std::function< void ( int, std::string & ) > &fun, int num_threads = 0 );
+
+// The Triangle library keeps state in globals, hold this around
+// triangle_context_create through triangle_mesh_create.
+std::mutex & TriangleMutex();
+
+}
+
+#endif
@@ -6,6 +6,9 @@
 #include "StringUtil.h"
 #include "APIDefines.h"
 
+#include <cstdarg>
+#include <cstdio>
+
 void StringUtil::change_from_to( char *str, const char &from, const char &to )
 {
     int i = 0;
@@ -285,3 +288,35 @@ string StringUtil::NasFmt( double input )
         }
     }
 }
+
+//==== Append printf Style Formatted Text To A String ====//
+void StringUtil::append_format( string & str, const char* format, ... )
+{
+    char buf[256];
+
+    va_list args;
+    va_start( args, format );
+    int n = vsnprintf( buf, sizeof( buf ), format, args );
+    va_end( args );
+
+    if ( n < 0 )
+    {
+        return;
+    }
+
+    if ( n < ( int )sizeof( buf ) )
+    {
+        str.append( buf, n );
+        return;
+    }
+
+    //==== Long Result, Format Again Directly Into The String ====//
+    size_t start = str.size();
+    str.resize( start + n + 1 );
+
+    va_start( args, format );
+    vsnprintf( &str[start], n + 1, format, args );
+    va_end( args );
+
+    str.resize( start + n );
+}
@@ -41,6 +41,8 @@ string truncateFileName( const string &fn, int len );
 
 string NasFmt( double input );
 
+void append_format( string & str, const char* format, ... );
+
 }
 
 
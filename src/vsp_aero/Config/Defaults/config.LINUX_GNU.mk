@@ -8,6 +8,7 @@ CXX = g++
 
 # These are extra CXXFLAGS and LDFLAGS specific to building the code under `Solver/`.
 SOLVER_CXXFLAGS = -fPIC -std=c++11 -O3 -funroll-loops -funroll-all-loops -Wno-unused -Wno-format-security -Wno-format-overflow
+# Add -march=native to let the compiler use AVX2/AVX-512 for the batched vortex edge kernels
 # Reasonable debug flags
 # SOLVER_CXXFLAGS = -fPIC -O0 -g -fsanitize=address
 SOLVER_LDFLAGS =